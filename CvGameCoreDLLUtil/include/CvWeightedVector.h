@@ -4,6 +4,9 @@
 #define CIV5_WEIGHTED_VECTOR_H
 
 #include <algorithm>
+#ifdef AUI_WEIGHTED_VECTOR_PARTIAL_SORT_TOP_CHOICES
+#include <functional>
+#endif // AUI_WEIGHTED_VECTOR_PARTIAL_SORT_TOP_CHOICES
 #include "EventSystem/FastDelegate.h"
 #include "FFastVector.h"
 
@@ -48,6 +51,23 @@ public:
 
 	};
 
+#ifdef AUI_WEIGHTED_VECTOR_PARTIAL_SORT_TOP_CHOICES
+	/// Predicate for partitioning off the elements whose weight is at least some cutoff
+	struct WeightAtLeast
+	{
+		WeightAtLeast(int iCutoff) : m_iCutoff(iCutoff)
+		{
+		}
+
+		bool operator() (const WeightedElement& elem) const
+		{
+			return elem.m_iWeight >= m_iCutoff;
+		};
+
+		int m_iCutoff;
+	};
+#endif // AUI_WEIGHTED_VECTOR_PARTIAL_SORT_TOP_CHOICES
+
 	/// Default constructor
 	CvWeightedVector(void)
 	{
@@ -145,6 +165,36 @@ public:
 		std::stable_sort(m_pItems.begin(), m_pItems.end());
 	}
 
+#ifdef AUI_WEIGHTED_VECTOR_PARTIAL_SORT_TOP_CHOICES
+	/// Only sorts the iNumTop highest weights (plus anything tied with the lowest of them) to the front, in the same order StableSortItems() would; everything else stays behind them in its original order
+	void StableSortTopItems(int iNumTop)
+	{
+		int iNumItems = (int) m_pItems.size();
+		if (iNumTop >= iNumItems)
+		{
+			StableSortItems();
+			return;
+		}
+		if (iNumTop <= 0)
+		{
+			return;
+		}
+
+		// Find the lowest weight that still makes the cut
+		FStaticVector<int, L, true> aiWeights;
+		aiWeights.reserve(iNumItems);
+		for (int i = 0; i < iNumItems; i++)
+		{
+			aiWeights.push_back(m_pItems[i].m_iWeight);
+		}
+		std::nth_element(aiWeights.begin(), aiWeights.begin() + (iNumTop - 1), aiWeights.end(), std::greater<int>());
+
+		// Everything at or above that weight goes to the front without losing its relative order, then only that part is sorted
+		WeightedElement* pTopEnd = std::stable_partition(m_pItems.begin(), m_pItems.end(), WeightAtLeast(aiWeights[iNumTop - 1]));
+		std::stable_sort(m_pItems.begin(), pTopEnd);
+	}
+#endif // AUI_WEIGHTED_VECTOR_PARTIAL_SORT_TOP_CHOICES
+
 	/// Return a random entry by weight, but avoid unlikely candidates (by only looking at candidates with a certain percentage chance)
 	T ChooseAbovePercentThreshold(int iPercent, RandomNumberDelegate *rndFcn, const char *szRollName)
 	{
@@ -198,6 +248,23 @@ public:
 		WeightedElement elem;
 		int iChoice;
 
+#ifdef AUI_WEIGHTED_VECTOR_CUMULATIVE_WEIGHT_SAMPLING
+		FStaticVector<int, L, true> aiCumulativeWeights;
+		bool bAscending;
+
+		// Random roll up to total weight
+		iChoice = (*rndFcn)(BuildCumulativeWeights(m_pItems.size(), aiCumulativeWeights, bAscending), szRollName);
+
+		unsigned int uiChosen = FindByCumulativeWeight(aiCumulativeWeights, bAscending, iChoice);
+		if (uiChosen < m_pItems.size())
+		{
+			return m_pItems[uiChosen].m_Element;
+		}
+		if (m_pItems.size() > 0)
+		{
+			elem = m_pItems[m_pItems.size() - 1];
+		}
+#else
 		// Random roll up to total weight
 		iChoice = (*rndFcn)(GetTotalWeight(), szRollName);
 
@@ -211,6 +278,7 @@ public:
 				return elem.m_Element;
 			}
 		}
+#endif // AUI_WEIGHTED_VECTOR_CUMULATIVE_WEIGHT_SAMPLING
 
 		// We should have found something, so reaching here is an error
 		//    Just return last thing accessed
@@ -239,6 +307,27 @@ public:
 		int iChoice;
 		int iTotalTopChoicesWeight = 0;
 
+#ifdef AUI_WEIGHTED_VECTOR_CUMULATIVE_WEIGHT_SAMPLING
+		FStaticVector<int, L, true> aiCumulativeWeights;
+		bool bAscending;
+
+		// Get the total weight
+		iTotalTopChoicesWeight = BuildCumulativeWeights((unsigned int) iNumChoices, aiCumulativeWeights, bAscending);
+
+		// Random roll up to total weight
+		iChoice = (*rndFcn)(iTotalTopChoicesWeight, szRollName);
+
+		// Find out which element was chosen
+		i = (int) FindByCumulativeWeight(aiCumulativeWeights, bAscending, iChoice);
+		if (i < iNumChoices)
+		{
+			return m_pItems[i].m_Element;
+		}
+		if (iNumChoices > 0)
+		{
+			elem = m_pItems[iNumChoices - 1];
+		}
+#else
 		// Get the total weight
 		for (i = 0; i < iNumChoices; i++)
 		{
@@ -259,6 +348,7 @@ public:
 				return elem.m_Element;
 			}
 		}
+#endif // AUI_WEIGHTED_VECTOR_CUMULATIVE_WEIGHT_SAMPLING
 
 		// We should have found something, so reaching here is an error
 		//    Just return last thing accessed
@@ -267,6 +357,45 @@ public:
 	};
 
 private:
+#ifdef AUI_WEIGHTED_VECTOR_CUMULATIVE_WEIGHT_SAMPLING
+	/// Fills aiCumulativeWeights with the running weight totals of the first uiNumItems elements and returns their total; bAscending is cleared if a negative weight makes the totals go down
+	int BuildCumulativeWeights(unsigned int uiNumItems, FStaticVector<int, L, true>& aiCumulativeWeights, bool& bAscending) const
+	{
+		aiCumulativeWeights.reserve(uiNumItems);
+		bAscending = true;
+		int iRunningTotal = 0;
+		for (unsigned int i = 0; i < uiNumItems; i++)
+		{
+			if (m_pItems[i].m_iWeight < 0)
+			{
+				bAscending = false;
+			}
+			iRunningTotal += m_pItems[i].m_iWeight;
+			aiCumulativeWeights.push_back(iRunningTotal);
+		}
+		return iRunningTotal;
+	}
+
+	/// Index of the first element whose running total exceeds iChoice (i.e. the one the "iChoice -= weight" scan lands on), the number of totals if none does
+	static unsigned int FindByCumulativeWeight(const FStaticVector<int, L, true>& aiCumulativeWeights, bool bAscending, int iChoice)
+	{
+		if (bAscending)
+		{
+			return std::upper_bound(aiCumulativeWeights.begin(), aiCumulativeWeights.end(), iChoice) - aiCumulativeWeights.begin();
+		}
+
+		// Negative weights make the totals go down again, so the binary search could skip past the element the scan would find
+		for (unsigned int i = 0; i < aiCumulativeWeights.size(); i++)
+		{
+			if (aiCumulativeWeights[i] > iChoice)
+			{
+				return i;
+			}
+		}
+		return aiCumulativeWeights.size();
+	}
+#endif // AUI_WEIGHTED_VECTOR_CUMULATIVE_WEIGHT_SAMPLING
+
 	FStaticVector<WeightedElement, L, bPODType> m_pItems;
 };
 
@@ -23,6 +23,8 @@
 #define AUI_STARTPOSITIONER_COASTAL_CIV_WATER_BIAS
 /// When calculating the founding value of a tile, tailor the SiteEvaluation function to the current player instead of the first one
 #define AUI_STARTPOSITIONER_FLAVORED_STARTS
+/// CvFractal::getHeightFromPercent() counts the fractal's heights into a histogram once instead of rescanning the whole fractal for every step of its binary search (same result)
+#define AUI_FRACTAL_HEIGHT_FROM_PERCENT_HISTOGRAM
 /// Enables performance logging based on ini settings like normal instead of hard-disabling
 #define AUI_PERF_LOGGING_ENABLED
 /// Fast comparison functions (to be used for built-in types like int, float, double, etc.)
@@ -47,6 +49,12 @@
 #define AUI_PLOT_SEE_FROM_SIGHT_NO_MAXIMUM_SIGHT_RANGE
 /// When choosing the top n choices from a weighted vector, choices with weight equal to the last choice are also included
 #define AUI_WEIGHTED_VECTOR_FIX_TOP_CHOICES_TIE
+/// ChooseByWeight() and ChooseFromTopChoices() total the weights into a local running-total array in one pass and find the rolled element with a binary search instead of a second scan (same roll, same element)
+#define AUI_WEIGHTED_VECTOR_CUMULATIVE_WEIGHT_SAMPLING
+/// Production, tech and attack target choices only sort their top N choices (ties included) instead of the whole vector; equal-weight choices then keep their insertion order instead of std::sort's, so the same roll can pick a different one of them
+//#define AUI_WEIGHTED_VECTOR_PARTIAL_SORT_TOP_CHOICES
+/// Lua instance tables for game objects (Player, Unit, City, Plot, etc.) also store their pointer under a per-type light userdata key, so GetInstance() on every method call is a raw pointer-keyed lookup instead of a string-keyed lua_getfield() (the "__instance" field is still set and used as a fallback)
+#define AUI_LUA_SCOPED_INSTANCE_LIGHTUSERDATA_KEY
 /// Adds a new function to CvPlot that calculates the strategic value of a plot based on river crossing count, whether it's hills, and chokepoint factor
 #define AUI_PLOT_CALCULATE_STRATEGIC_VALUE
 /// Adds a new function to CvPlot to count how many times the given plot is in a list
@@ -63,6 +71,26 @@
 #define AUI_FIX_HEX_DISTANCE_INSTEAD_OF_PLOT_DISTANCE
 /// Implements the missing erase(iterator) function for FFastVector
 #define AUI_FIX_FFASTVECTOR_ERASE
+/// Unit position/health/experience/level, city population and player gold feed a rolling checksum that is updated by their setters, so calculateSyncChecksum() no longer walks every unit
+#define AUI_GAME_ROLLING_SYNC_CHECKSUM
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+/// Debug: every calculateSyncChecksum() call also recalculates the rolling checksum from scratch and reports the first field that diverges
+//#define AUI_GAME_ROLLING_SYNC_CHECKSUM_VALIDATE
+#endif
+/// While game data is being prefetched, CvDatabaseUtility::MaxRows() caches its per-table results instead of running a new max(rowid) query for every array of every info entry; collections also reserve their final size up front
+#define AUI_DATABASE_UTILITY_PREFETCH_CACHE_MAX_ROWS
+/// Arrays, ArrayWrappers, FFastVectors, FStaticVectors and std::vectors of arithmetic types are moved to and from FDataStream as a single contiguous block instead of one virtual call per element (byte format is unchanged)
+#define AUI_DATASTREAM_BULK_POD_SERIALIZATION
+/// CvBarbarians::DoCamps() skips its map pass when no camp could be added anyway, and checks plot visibility only against the civ teams that are alive (collected once) instead of re-testing every civ team's alive status on every plot
+#define AUI_BARBARIAN_DO_CAMPS_FAST_FOG_COUNT
+/// CvNotifications keeps a count of its undismissed notifications per redundancy key (type plus whichever of location/data fields the type's redundancy test compares), so most redundancy tests and the tech notification's free tech test no longer scan the whole notification ring
+#define AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+#ifdef AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+/// Also runs the original ring scan for every indexed redundancy test and asserts that both agree
+//#define AUI_NOTIFICATIONS_REDUNDANCY_INDEX_VALIDATE
+#endif
+/// The tactical and homeland AIs' per-turn unit ID lists take their nodes from a recycling node pool (CvNodePoolAllocator) instead of allocating and freeing one heap block per unit every time the lists are rebuilt
+#define AUI_AI_UNIT_ID_LIST_NODE_POOL
 
 #ifdef AUI_FAST_COMP
 // Avoids Visual Studio's compiler from generating inefficient code
@@ -90,6 +118,12 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_ASTAR_FIX_CONSIDER_DANGER_USES_COMBAT_STRENGTH (6)
 /// AI-controlled units no longer ignore all paths with peaks; since the peak plots are check anyway for whether or not a unit can enter them, this check is pointless 
 #define AUI_ASTAR_FIX_PATH_VALID_PATH_PEAKS_FOR_NONHUMAN
+/// The unit pathfinders' cost and add functions share one movement cost evaluation per step: the result for each step out of a node is cached on that node (per direction) for the rest of the current path search
+#define AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+/// Also recomputes every cached step cost and asserts that it still matches
+//#define AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS_VALIDATE
+#endif
 
 // AI Operations Stuff
 /// If a settler tries and fails the no escort check, keep rerolling each turn
@@ -124,6 +158,8 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_OPERATION_TWEAKED_FIND_BEST_TARGET_NUKE
 /// If a civilian retargets and an escort cannot get to the new target (ignoring units), then the operation is aborted
 #define AUI_OPERATION_FIX_RETARGET_CIVILIAN_ABORT_IF_UNREACHABLE_ESCORT
+/// Pillage operations on the move and naval superiority operations only rerun their per-turn full target search once every this many turns, staggered by operation ID, unless their current target is no longer one the search could pick
+#define AUI_OPERATION_STAGGERED_RETARGET (3)
 
 // Worker Automation Stuff
 /// Automated Inca workers know that there is no maintenance on hills, so routines are adjusted as a result
@@ -172,6 +208,8 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_WORKER_FIX_SHOULD_CONSIDER_PLOT_WORK_BOATS_CONSIDER_ALL_SEA_PLOTS
 /// Only disregard an impassable plot if the unit cannot enter impassable plots
 #define AUI_WORKER_FIX_SHOULD_CONSIDER_PLOT_FLYING_WORKER_DISREGARDS_PEAKS
+/// During a homeland worker pass, projected yield scores for a plot+build pair are computed once and shared by all of the player's workers instead of being recomputed for every worker (never filled outside that pass, eg. by the UI's recommended actions)
+#define AUI_WORKER_SHARED_PLOT_BUILD_SCORES
 
 // City Stuff
 /// Shifts the scout assignment code to EconomicAI
@@ -206,6 +244,12 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 //#define AUI_CITYSTRATEGY_CHOOSE_PRODUCTION_NORMALIZE_LIST
 /// If the player has yet to unlock an ideology, multiply the base weight of buildings that can unlock ideologies by this value
 #define AUI_CITYSTRATEGY_EMPHASIZE_FACTORIES_IF_NO_IDEOLOGY (8)
+/// ChooseProduction() only runs canConstruct()/canTrain()/canCreate() on items that pass a cached prerequisite filter (civ uniques, techs, obsolescence, policies, buildings already in the city); the filter is only redone when the team's techs, the player's policies or the city's buildings change
+#define AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+/// Debug: rebuilds the filter on every call and asserts that it matches the cached one and never rejects something the full checks accept
+//#define AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE_VALIDATE
+#endif
 
 // Culture Classes Stuff
 /// AI only wants propaganda diplomats with players of different ideologies (since that's the only time they get the tourism bonus)
@@ -233,6 +277,14 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 /// Counts air unit strength into danger (commented out for now)
 //#define AUI_DANGER_PLOTS_COUNT_AIR_UNITS
 
+// DealAI Stuff
+/// While a deal is being equalized, trade item values are remembered by item type, data, duration and direction instead of being recalculated every time the deal is re-valued
+#define AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE
+#ifdef AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE
+/// Debug: trade item values are always recalculated and asserted to be equal to the remembered value
+//#define AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE_VALIDATE
+#endif
+
 // DiplomacyAI Stuff
 /// If the first adjusted value is out of bounds, keep rerolling with the amount with which it is out of bounds until we remain in bounds
 #define AUI_DIPLOMACY_GET_RANDOM_PERSONALITY_WEIGHT_USE_REROLLS
@@ -292,6 +344,16 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_ECONOMIC_FIX_GET_BEST_GREAT_WORK_CITY_NO_DAMAGE_FILTER
 /// Player settlers captured by barbarians still add to the player's settler count
 #define AUI_ECONOMIC_EARLY_EXPANSION_CAPTURED_BARBARIAN_SETTLERS_COUNT
+/// UpdatePlots() keeps a persistent exploration frontier and goody hut candidate list that plots are only rescored into when they (or their neighbors) are revealed or change terrain/improvements, instead of rescoring the entire map every call
+#define AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+/// Debug: every UpdatePlots() call also does the full map rescan and asserts that it matches the incrementally maintained lists
+//#define AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER_VALIDATE
+#endif
+
+// Espionage AI Stuff
+/// Target city lists are only built on turns where at least one spy is waiting to be (re)assigned, since otherwise DoTurn() never acts on them; the most expensive researchable tech is only looked up when an offense target has no better estimate
+#define AUI_ESPIONAGE_AI_LAZY_TARGET_LISTS
 
 // Flavor Manager Stuff
 /// Players that start as human no longer load in default flavor values
@@ -438,6 +500,20 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_MILITARY_ROLL_FOR_NUKES_CONSIDER_STRENGTH_DIFFERENCE
 /// The game turn portion of calculating the recommended navy size now changes based on game speed
 #define AUI_MILITARY_FIX_COMPUTE_RECOMMENDED_NAVY_SIZE_GAME_TURN_SCALING (0.6)
+/// FindBestAttackTarget() remembers the land/sea path checks it made for each muster city/target city pair until plot ownership, war or open borders, city-state friendship, terrain or the player's embarkation abilities change
+#define AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+/// Debug: redoes every path check and asserts that the remembered result matches
+//#define AUI_MILITARY_ATTACK_TARGET_PATH_CACHE_VALIDATE
+#endif
+
+// Minor Civ AI Stuff
+/// Wonder and Great Person quests remember a "not complete yet" or "not expired yet" result until a world wonder changes hands or the assigned player gets a new unit, so the per-turn quest tests stop rescanning every player's cities and units
+#define AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+/// Debug: always runs the full tests and asserts that a remembered result still matches
+//#define AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS_VALIDATE
+#endif
 
 // Player Stuff (PlayerAI is later)
 /// Fixes AI Shoshone Pathfinders not getting any goody hut bonuses (TODO: have AI Shoshone actually choose their goody hut bonus instead of getting a random one)
@@ -462,6 +538,14 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_PLAYER_GET_BEST_SETTLE_PLOT_USE_MINIMUM_FERTILITY
 /// Minor code modifications that are minor optimizations and help with debugging
 #define AUI_PLAYER_GET_BEST_SETTLE_PLOT_DEBUG_HELP
+/// Replay datasets are looked up through a hash map and stored as dense per-turn columns instead of one std::map node per turn; saves delta-encode each column (bumps CvPlayer save version to 17, older saves still load)
+#define AUI_PLAYER_COLUMNAR_REPLAY_DATA
+/// GetNumUnitsWithUnitAI(), GetNumUnitsWithDomain() and GetNumUnitsWithUnitCombat() read per-player counters that units and city production queues keep up to date instead of walking every unit (and every city) on each call
+#define AUI_PLAYER_UNIT_COUNTERS
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+/// Debug: also runs the original scans and asserts that they agree with the counters
+//#define AUI_PLAYER_UNIT_COUNTERS_VALIDATE
+#endif
 
 // PlayerAI Stuff
 /// Great prophet will be chosen as a free great person if the AI can still found a religion with them
@@ -548,6 +632,12 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_POLICY_DO_CONSIDER_IDEOLOGY_SWITCH_TWEAKED_CLEAR_PREFS
 /// Gets all possible happiness sources the branch can give, not just building-based ones (eg. specialists, trade routes, luxuries, etc.)
 #define AUI_POLICY_GET_BRANCH_BUILDING_HAPPINESS_GET_ALL_HAPPINESS_SOURCES
+/// Prerequisite weight propagation walks a precomputed list of (prerequisite, depth, number of paths) per policy instead of recursing through the tree for every weighted policy; resulting weights are identical
+#define AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
+#ifdef AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
+/// Debug: also runs the recursive propagation and asserts that both produce the same weights
+//#define AUI_POLICY_PREREQ_PROPAGATION_CLOSURE_VALIDATE
+#endif
 
 // Religion/Belief Stuff
 /// VITAL FOR MOST FUNCTIONS! Use double instead of int for certain variables (to retain information during division)
@@ -884,6 +974,8 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_TACTICAL_ANALYSIS_MAP_CALCULATE_MILITARY_STRENGTHS_USE_PATHFINDER
 /// When calculating unit strengths, the unit's city attack power will be used instead of its unmodified damage
 #define AUI_TACTICAL_ANALYSIS_MAP_CALCULATE_MILITARY_STRENGTHS_CONSIDER_CITY_ATTACK_BONUS
+/// Combat units of the player and of every player it is at war with are bucketed once per refresh into land zone and water zone lists (in unit list order), so each dominance zone only walks the units that can count towards it
+#define AUI_TACTICAL_ANALYSIS_MAP_CALCULATE_MILITARY_STRENGTHS_UNIT_BUCKETS
 
 // Team Stuff
 #ifdef AUI_FLAVOR_MANAGER_RANDOMIZE_WEIGHTS_ON_ERA_CHANGE
@@ -902,6 +994,12 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 // Tech AI Stuff
 /// The AI wants an expensive tech if it's selecting a free tech
 #define AUI_TECHAI_CHOOSE_NEXT_TECH_FREE_TECH_WANTS_EXPENSIVE
+/// Prerequisite weight propagation walks a precomputed list of (prerequisite, depth, number of paths) per tech instead of recursing through the tree for every weighted tech; resulting weights are identical
+#define AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
+#ifdef AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
+/// Debug: also runs the recursive propagation and asserts that both produce the same weights
+//#define AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE_VALIDATE
+#endif
 
 // Trade Stuff
 /// Adds a minimum danger amount for each plot, to discourage long routes
@@ -946,6 +1044,8 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_UNIT_CAN_MOVE_AND_RANGED_STRIKE
 #endif
 #endif
+/// IsSlowedByZOC() only looks at the (at most two) plots adjacent to both the origin and the destination of a move, and skips enemy unit lists entirely if the destination holds a visible enemy unit, instead of scanning all six neighbors of the origin and all six neighbors of every enemy found
+#define AUI_UNIT_MOVEMENT_ZOC_SHARED_NEIGHBORS_ONLY
 
 // Promition Stuff (within CvUnit.cpp)
 /// Use double instead of int for most variables (to retain information during division) inside AI_promotionValue()
@@ -994,6 +1094,12 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_VOTING_TWEAKED_WORLD_RELIGION
 /// Uses a different algorithm and unifies the code for scoring voting on arts funding and sciences funding
 #define AUI_VOTING_TWEAKED_ARTS_SCIENCES_FUNDING
+/// While the AI allocates its votes or proposals or equalizes a deal, alignments and vote trade desires are remembered instead of being recalculated for every proposal or trade item (never remembered outside of those passes, eg. for UI deal values)
+#define AUI_VOTING_SCORE_CACHE
+#ifdef AUI_VOTING_SCORE_CACHE
+/// Debug: scores are always recalculated and asserted to be equal to the remembered value
+//#define AUI_VOTING_SCORE_CACHE_VALIDATE
+#endif
 
 // Wonder Production AI Stuff
 /// Does a flavor update each time a wonder is to be chosen (helps when multiple wonders are to be chosen in a single turn)
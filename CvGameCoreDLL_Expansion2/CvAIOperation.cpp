@@ -840,6 +840,14 @@ int CvAIOperation::PercentFromMusterPointToTarget()
 	return iRtnValue;
 }
 
+#ifdef AUI_OPERATION_STAGGERED_RETARGET
+/// Is it this operation's turn to rerun its full target search? Offset by ID so operations don't all search on the same turn
+bool CvAIOperation::IsStaggeredRetargetTurn() const
+{
+	return (GC.getGame().getGameTurn() + m_iID) % AUI_OPERATION_STAGGERED_RETARGET == 0;
+}
+#endif
+
 
 /// Returns true when we should abort the operation totally (besides when we have lost all units in it)
 bool CvAIOperation::ShouldAbort()
@@ -2940,6 +2948,14 @@ bool CvAIOperationPillageEnemy::ArmyMoved(CvArmyAI* pArmy)
 	{
 	case AI_OPERATION_STATE_MOVING_TO_TARGET:
 	{
+#ifdef AUI_OPERATION_STAGGERED_RETARGET
+		// Keep heading for a target that still checks out unless it's this operation's turn to look for a better one
+		if(!IsStaggeredRetargetTurn() && IsCurrentTargetStillValid())
+		{
+			break;
+		}
+
+#endif
 		// Find best pillage target
 		pBetterTarget = FindBestTarget();
 
@@ -3061,6 +3077,40 @@ CvPlot* CvAIOperationPillageEnemy::FindBestTarget()
 	}
 }
 
+#ifdef AUI_OPERATION_STAGGERED_RETARGET
+/// Is our target still a city FindBestTarget() could pick?
+bool CvAIOperationPillageEnemy::IsCurrentTargetStillValid() const
+{
+	CvPlot* pTargetPlot = GetTargetPlot();
+	if(pTargetPlot == NULL || !GET_PLAYER(m_eEnemy).isAlive())
+	{
+		return false;
+	}
+
+	CvCity* pTargetCity = pTargetPlot->getPlotCity();
+	if(pTargetCity == NULL || pTargetCity->getOwner() != m_eEnemy)
+	{
+		return false;
+	}
+
+	CvCity* pStartCity = GetOperationStartCity();
+	if(pStartCity == NULL || pTargetCity->getArea() != pStartCity->getArea())
+	{
+		return false;
+	}
+
+	// Same value FindBestTarget() gives the city; only one step path instead of one per enemy city
+	int iValue = pTargetCity->countNumImprovedPlots();
+	int iDistance = GC.getStepFinder().GetStepDistanceBetweenPoints(m_eOwner, m_eEnemy, pTargetCity->plot(), pStartCity->plot());
+	if(iDistance > 0)
+	{
+		iValue = iValue * 100 / iDistance;
+	}
+
+	return iValue > 0;
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // CvAIEscortedOperation
 ////////////////////////////////////////////////////////////////////////////////
@@ -4637,6 +4687,14 @@ bool CvAIOperationNavalSuperiority::ArmyInPosition(CvArmyAI* pArmy)
 		// First do base case processing
 		bStateChanged = CvAIOperation::ArmyInPosition(pArmy);
 
+#ifdef AUI_OPERATION_STAGGERED_RETARGET
+		// Keep our target if it still checks out unless it's this operation's turn to look for a better one
+		if(!IsStaggeredRetargetTurn() && IsCurrentTargetStillValid())
+		{
+			break;
+		}
+
+#endif
 		// Now revisit target
 		CvPlot* possibleBetterTarget;
 		possibleBetterTarget = FindBestTarget();
@@ -4891,6 +4949,58 @@ CvPlot* CvAIOperationNavalSuperiority::FindBestTarget()
 	return pBestPlot;
 }
 
+#ifdef AUI_OPERATION_STAGGERED_RETARGET
+/// Is our target still an enemy unit at sea, or a patrol plot next to an enemy coastal city or barbarian camp?
+bool CvAIOperationNavalSuperiority::IsCurrentTargetStillValid() const
+{
+	CvPlot* pTargetPlot = GetTargetPlot();
+	TeamTypes eTeam = GET_PLAYER(m_eOwner).getTeam();
+	if(pTargetPlot == NULL || !pTargetPlot->isRevealed(eTeam) || !pTargetPlot->isWater())
+	{
+		return false;
+	}
+
+	for(int iUnitLoop = 0; iUnitLoop < pTargetPlot->getNumUnits(); iUnitLoop++)
+	{
+		CvUnit* pLoopUnit = pTargetPlot->getUnitByIndex(iUnitLoop);
+		if(pLoopUnit != NULL && pLoopUnit->isEnemy(eTeam))
+		{
+			return true;
+		}
+	}
+
+	// Backup targets are shallow water plots next to the closest enemy coastal city or barbarian camp
+	if(!pTargetPlot->isShallowWater())
+	{
+		return false;
+	}
+
+	for(int iDirectionLoop = 0; iDirectionLoop < NUM_DIRECTION_TYPES; ++iDirectionLoop)
+	{
+		CvPlot* pAdjacentPlot = plotDirection(pTargetPlot->getX(), pTargetPlot->getY(), ((DirectionTypes)iDirectionLoop));
+		if(pAdjacentPlot == NULL || !pAdjacentPlot->isRevealed(eTeam) || !pAdjacentPlot->isCoastalLand())
+		{
+			continue;
+		}
+
+		CvCity* pCity = pAdjacentPlot->getPlotCity();
+		if(pCity != NULL)
+		{
+			if(atWar(eTeam, pCity->getTeam()))
+			{
+				return true;
+			}
+		}
+		else if(pAdjacentPlot->getImprovementType() == GC.getBARBARIAN_CAMP_IMPROVEMENT())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // CvAIOperationPureNavalCityAttack
 ////////////////////////////////////////////////////////////////////////////////
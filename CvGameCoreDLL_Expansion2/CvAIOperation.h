@@ -261,6 +261,9 @@ protected:
 
 	virtual CvPlot* SelectInitialMusterPoint(CvArmyAI* pThisArmy);
 	virtual bool FindBestFitReserveUnit(OperationSlot thisOperationSlot, CvPlot* pMusterPlot, CvPlot* pTargetPlot, bool* bRequired);
+#ifdef AUI_OPERATION_STAGGERED_RETARGET
+	bool IsStaggeredRetargetTurn() const;
+#endif
 
 	std::vector<int> m_viArmyIDs;
 	std::vector<OperationSlot> m_viListOfUnitsWeStillNeedToBuild;
@@ -498,6 +501,9 @@ public:
 
 protected:
 	virtual CvPlot* FindBestTarget();
+#ifdef AUI_OPERATION_STAGGERED_RETARGET
+	bool IsCurrentTargetStillValid() const;
+#endif
 };
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -748,6 +754,9 @@ public:
 
 protected:
 	virtual CvPlot* FindBestTarget();
+#ifdef AUI_OPERATION_STAGGERED_RETARGET
+	bool IsCurrentTargetStillValid() const;
+#endif
 };
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -109,6 +109,9 @@ CvAStar::CvAStar()
 
 	m_bIsMPCacheSafe = false;
 	m_bDataChangeInvalidatesCache = false;
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+	m_iSearchID = 0;
+#endif
 }
 
 //	--------------------------------------------------------------------------------
@@ -207,6 +210,10 @@ bool CvAStar::GeneratePath(int iXstart, int iYstart, int iXdest, int iYdest, int
 	m_iXstart = iXstart;
 	m_iYstart = iYstart;
 	m_iInfo = iInfo;
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+	// Units, plots and the unit being pathed may all have changed since the last search
+	m_iSearchID++;
+#endif
 
 	if (udInitializeFunc)
 		udInitializeFunc(m_pData, this);
@@ -830,6 +837,64 @@ void UnitPathUninitialize(const void* pointer, CvAStar* finder)
 
 }
 
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+//	--------------------------------------------------------------------------------
+/// Movement cost of the unit's step from parent to node, or -1 if the step uses up all of the unit's remaining moves (CvUnitMovement::ConsumesAllMoves() or, unless ZOC is ignored, CvUnitMovement::IsSlowedByZOC())
+int PathStepMoveCost(CvAStarNode* parent, CvAStarNode* node, const CvUnit* pUnit, const UnitPathCacheData* pCacheData, const CvAStar* finder, bool bIgnoreZOC)
+{
+	CvMap& kMap = GC.getMap();
+	CvPlot* pFromPlot = kMap.plotUnchecked(parent->m_iX, parent->m_iY);
+	CvPlot* pToPlot = kMap.plotUnchecked(node->m_iX, node->m_iY);
+
+	// Only steps to adjacent plots are cached, extra children (eg. paradrops) are always recalculated
+	DirectionTypes eDirection = directionXY(pFromPlot, pToPlot);
+	if(eDirection != NO_DIRECTION && plotDirection(parent->m_iX, parent->m_iY, eDirection) != pToPlot)
+	{
+		eDirection = NO_DIRECTION;
+	}
+
+	if(eDirection != NO_DIRECTION)
+	{
+		if(parent->m_iStepMoveCostSearch != finder->GetSearchID() || parent->m_bStepMoveCostIgnoreZOC != bIgnoreZOC)
+		{
+			parent->m_iStepMoveCostSearch = finder->GetSearchID();
+			parent->m_bStepMoveCostIgnoreZOC = bIgnoreZOC;
+			for(int iI = 0; iI < NUM_DIRECTION_TYPES; iI++)
+			{
+				parent->m_aiStepMoveCost[iI] = -2;
+			}
+		}
+#ifndef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS_VALIDATE
+		else if(parent->m_aiStepMoveCost[eDirection] != -2)
+		{
+			return parent->m_aiStepMoveCost[eDirection];
+		}
+#endif
+	}
+
+	int iCost;
+	if(CvUnitMovement::ConsumesAllMoves(pUnit, pFromPlot, pToPlot) || (!bIgnoreZOC && CvUnitMovement::IsSlowedByZOC(pUnit, pFromPlot, pToPlot)))
+	{
+		iCost = -1;
+	}
+	else
+	{
+		// Zone of control has already been ruled out, so this returns the same cost as MovementCost()
+		iCost = CvUnitMovement::MovementCostNoZOC(pUnit, pFromPlot, pToPlot, pCacheData->baseMoves((pToPlot->isWater() || pCacheData->isEmbarked())?DOMAIN_SEA:pCacheData->getDomainType()), pCacheData->maxMoves());
+	}
+
+	if(eDirection != NO_DIRECTION)
+	{
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS_VALIDATE
+		CvAssertMsg(parent->m_aiStepMoveCost[eDirection] == -2 || parent->m_aiStepMoveCost[eDirection] == iCost, "Cached step movement cost no longer matches the movement cost functions");
+#endif
+		parent->m_aiStepMoveCost[eDirection] = iCost;
+	}
+
+	return iCost;
+}
+#endif
+
 //	--------------------------------------------------------------------------------
 int PathDest(int iToX, int iToY, const void* pointer, CvAStar* finder)
 {
@@ -993,6 +1058,9 @@ int PathCost(CvAStarNode* parent, CvAStarNode* node, int data, const void* point
 	CvAssertMsg(eUnitDomain != DOMAIN_AIR, "pUnit->getDomainType() is not expected to be equal with DOMAIN_AIR");
 
 	bool bToPlotIsWater = pToPlot->isWater() && !pToPlot->IsAllowsWalkWater();
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+	int iStepCost = PathStepMoveCost(parent, node, pUnit, pCacheData, finder, false);
+#endif
 	int iMax;
 	if(parent->m_iData1 > 0)
 	{
@@ -1000,7 +1068,11 @@ int PathCost(CvAStarNode* parent, CvAStarNode* node, int data, const void* point
 	}
 	else
 	{
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+		if (iStepCost < 0)
+#else
 		if (CvUnitMovement::ConsumesAllMoves(pUnit, pFromPlot, pToPlot) || CvUnitMovement::IsSlowedByZOC(pUnit, pFromPlot, pToPlot))
+#endif
 		{
 			// The movement would consume all moves, get the moves we will forfeit based on the source plot, rather than
 			// the destination plot.  This fixes issues where a land unit that has more movement points on water than on land
@@ -1015,7 +1087,11 @@ int PathCost(CvAStarNode* parent, CvAStarNode* node, int data, const void* point
 	// method wants to burn all our remaining moves.  This is needed because our remaining moves for this segment of the path
 	// may be larger or smaller than the baseMoves if some moves have already been used or if the starting domain (LAND/SEA)
 	// of the path segment is different from the destination plot.
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+	int iCost = (iStepCost < 0) ? ((iMax > 0) ? iMax : pCacheData->maxMoves()) : iStepCost;
+#else
 	int iCost = CvUnitMovement::MovementCost(pUnit, pFromPlot, pToPlot, pCacheData->baseMoves((pToPlot->isWater() || pCacheData->isEmbarked())?DOMAIN_SEA:pCacheData->getDomainType()), pCacheData->maxMoves(), iMax);
+#endif
 
 	TeamTypes eUnitTeam = pCacheData->getTeam();
 	bool bMaximizeExplore = finder->GetInfo() & MOVE_MAXIMIZE_EXPLORE;
@@ -1551,6 +1627,17 @@ int PathAdd(CvAStarNode* parent, CvAStarNode* node, int data, const void* pointe
 
 		// We can't use maxMoves, because that checks where the unit is currently, and we're plotting a path so we have to see
 		// what the max moves would be like if the unit was already at the desired location.
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+		int iStepCost = PathStepMoveCost(parent, node, pUnit, pCacheData, finder, false);
+		if (iStepCost < 0)
+		{
+			iMoves = 0;
+		}
+		else
+		{
+			iMoves = std::min(iMoves, std::max(0, iStartMoves - iStepCost));
+		}
+#else
 		if (CvUnitMovement::ConsumesAllMoves(pUnit, pFromPlot, pToPlot) || CvUnitMovement::IsSlowedByZOC(pUnit, pFromPlot, pToPlot))
 		{
 			iMoves = 0;
@@ -1563,6 +1650,7 @@ int PathAdd(CvAStarNode* parent, CvAStarNode* node, int data, const void* pointe
 			iMoves = std::min(iMoves, std::max(0, iStartMoves - CvUnitMovement::MovementCost(pUnit, pFromPlot, pToPlot, pCacheData->baseMoves((pToPlot->isWater() || pCacheData->isEmbarked())?DOMAIN_SEA:pCacheData->getDomainType()), pCacheData->maxMoves(), iStartMoves)));
 #endif // AUI_FAST_COMP
 		}
+#endif // AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
 	}
 
 	FAssertMsg(iMoves >= 0, "iMoves is expected to be non-negative (invalid Index)");
@@ -1716,7 +1804,15 @@ int IgnoreUnitsCost(CvAStarNode* parent, CvAStarNode* node, int data, const void
 	// method wants to burn all our remaining moves.  This is needed because our remaining moves for this segment of the path
 	// may be larger or smaller than the baseMoves if some moves have already been used or if the starting domain (LAND/SEA)
 	// of the path segment is different from the destination plot.
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+	iCost = PathStepMoveCost(parent, node, pUnit, pCacheData, finder, true);
+	if(iCost < 0)
+	{
+		iCost = (iMax > 0) ? iMax : pCacheData->maxMoves();
+	}
+#else
 	iCost = CvUnitMovement::MovementCostNoZOC(pUnit, pFromPlot, pToPlot, pCacheData->baseMoves((pToPlot->isWater() || pCacheData->isEmbarked())?DOMAIN_SEA:pCacheData->getDomainType()), pCacheData->maxMoves(), iMax);
+#endif
 
 	TeamTypes eUnitTeam = pUnit->getTeam();
 
@@ -1974,7 +2070,10 @@ int IgnoreUnitsPathAdd(CvAStarNode* parent, CvAStarNode* node, int data, const v
 
 		// We can't use maxMoves, because that checks where the unit is currently, and we're plotting a path so we have to see
 		// what the max moves would be like if the unit was already at the desired location.
-#ifdef AUI_FAST_COMP
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+		int iStepCost = PathStepMoveCost(parent, node, pUnit, pCacheData, finder, true);
+		iMoves = std::min(iMoves, std::max(0, iStartMoves - ((iStepCost < 0) ? pCacheData->maxMoves() : iStepCost)));
+#elif defined(AUI_FAST_COMP)
 		iMoves = FASTMIN(iMoves, FASTMAX(0, iStartMoves - CvUnitMovement::MovementCostNoZOC(pUnit, pFromPlot, pToPlot, pCacheData->baseMoves((pToPlot->isWater() || pCacheData->isEmbarked())?DOMAIN_SEA:pCacheData->getDomainType()), pCacheData->maxMoves())));
 #else
 		iMoves = std::min(iMoves, std::max(0, iStartMoves - CvUnitMovement::MovementCostNoZOC(pUnit, pFromPlot, pToPlot, pCacheData->baseMoves((pToPlot->isWater() || pCacheData->isEmbarked())?DOMAIN_SEA:pCacheData->getDomainType()), pCacheData->maxMoves())));
@@ -273,6 +273,9 @@ public:
 	void  SetScratchPointer2(void* pPtr) { m_pScratchPtr1 = pPtr; }
 
 	void* GetScratchBuffer() { return &m_ScratchBuffer[0]; }
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+	int GetSearchID() const { return m_iSearchID; }
+#endif
 	//--------------------------------------- PROTECTED FUNCTIONS -------------------------------------------
 protected:
 
@@ -342,6 +345,9 @@ protected:
 	void* m_pScratchPtr2;						// Will be cleared to NULL before each GeneratePath call
 
 	char  m_ScratchBuffer[SCRATCH_BUFFER_SIZE];	// Will NOT be modified directly by CvAStar
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+	int m_iSearchID;							// Incremented by each GeneratePath call, not saved
+#endif
 };
 
 
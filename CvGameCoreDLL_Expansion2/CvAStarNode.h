@@ -94,6 +94,11 @@ public:
 		m_pNext = NULL;
 		m_pPrev = NULL;
 		m_pStack = NULL;
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+
+		m_iStepMoveCostSearch = -1;
+		m_bStepMoveCostIgnoreZOC = false;
+#endif
 	}
 
 	void clear()
@@ -137,6 +142,12 @@ public:
 	bool m_bOnStack;
 
 	CvPathNodeCacheData m_kCostCacheData;
+
+#ifdef AUI_ASTAR_CACHE_STEP_MOVEMENT_COSTS
+	int m_aiStepMoveCost[NUM_DIRECTION_TYPES];	// Movement cost of stepping out of this node in each direction (-1 = uses up all moves, -2 = not calculated yet)
+	int m_iStepMoveCostSearch;					// Search the step costs were calculated for, they are stale once the pathfinder starts a new one
+	bool m_bStepMoveCostIgnoreZOC;				// Whether the step costs were calculated while ignoring zone of control
+#endif
 };
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
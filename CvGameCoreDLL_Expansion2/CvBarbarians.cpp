@@ -289,9 +289,26 @@ void CvBarbarians::DoCamps()
 	bool bAlwaysRevealedBarbCamp = false;
 
 	// Is there an appropriate Improvement to place as a Barb Camp?
+#ifdef AUI_BARBARIAN_DO_CAMPS_FAST_FOG_COUNT
+	// Without spawn odds or a fog tiles ratio no camp can be added, so the map pass would be wasted
+	if(eCamp != NO_IMPROVEMENT && GC.getBARBARIAN_CAMP_ODDS_OF_NEW_CAMP_SPAWNING() > 0 && GC.getMap().getWorldInfo().getFogTilesPerBarbarianCamp() != 0)
+#else
 	if(eCamp != NO_IMPROVEMENT)
+#endif // AUI_BARBARIAN_DO_CAMPS_FAST_FOG_COUNT
 	{
 		CvMap& kMap = GC.getMap();
+#ifdef AUI_BARBARIAN_DO_CAMPS_FAST_FOG_COUNT
+		// Same test as CvPlot::isVisibleToCivTeam(), but alive teams are collected once rather than once per plot
+		TeamTypes aeAliveCivTeams[MAX_CIV_TEAMS];
+		int iNumAliveCivTeams = 0;
+		for(int iTeamLoop = 0; iTeamLoop < MAX_CIV_TEAMS; iTeamLoop++)
+		{
+			if(GET_TEAM((TeamTypes)iTeamLoop).isAlive())
+			{
+				aeAliveCivTeams[iNumAliveCivTeams++] = (TeamTypes)iTeamLoop;
+			}
+		}
+#endif // AUI_BARBARIAN_DO_CAMPS_FAST_FOG_COUNT
 		// Figure out how many Nonvisible tiles we have to base # of camps to spawn on
 		for(int iI = 0; iI < kMap.numPlots(); iI++)
 		{
@@ -305,7 +322,20 @@ void CvBarbarians::DoCamps()
 
 			if(!pLoopPlot->isWater())
 			{
+#ifdef AUI_BARBARIAN_DO_CAMPS_FAST_FOG_COUNT
+				bool bVisibleToCivTeam = false;
+				for(int iTeamLoop = 0; iTeamLoop < iNumAliveCivTeams; iTeamLoop++)
+				{
+					if(pLoopPlot->getVisibilityCount(aeAliveCivTeams[iTeamLoop]) > 0)
+					{
+						bVisibleToCivTeam = true;
+						break;
+					}
+				}
+				if(!bVisibleToCivTeam)
+#else
 				if(!pLoopPlot->isVisibleToCivTeam())
+#endif // AUI_BARBARIAN_DO_CAMPS_FAST_FOG_COUNT
 				{
 					iNumNotVisiblePlots++;
 				}
@@ -51,6 +51,9 @@ void CvBuilderTaskingAI::Init(CvPlayer* pPlayer)
 	m_bLogging = GC.getLogging() && GC.getAILogging() && GC.GetBuilderAILogging();
 	m_iNumCities = -1;
 	m_pTargetPlot = NULL;
+#ifdef AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+	EndSharedPlotBuildScores();
+#endif // AUI_WORKER_SHARED_PLOT_BUILD_SCORES
 
 	// special case code so the Dutch don't remove marshes
 	m_bKeepMarshes = false;
@@ -104,6 +107,9 @@ void CvBuilderTaskingAI::Uninit(void)
 	m_bLogging = false;
 	m_iNumCities = -1;
 	m_pTargetPlot = NULL;
+#ifdef AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+	EndSharedPlotBuildScores();
+#endif // AUI_WORKER_SHARED_PLOT_BUILD_SCORES
 }
 
 /// Serialization read
@@ -138,6 +144,9 @@ void CvBuilderTaskingAI::Read(FDataStream& kStream)
 		
 	m_iNumCities = -1; //Force everyone to do an CvBuilderTaskingAI::Update() after loading
 	m_pTargetPlot = NULL;		//Force everyone to recalculate current yields after loading.
+#ifdef AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+	EndSharedPlotBuildScores();
+#endif // AUI_WORKER_SHARED_PLOT_BUILD_SCORES
 }
 
 /// Serialization write
@@ -165,6 +174,10 @@ void CvBuilderTaskingAI::Update(void)
 {
 	UpdateRoutePlots();
 	m_iNumCities = m_pPlayer->getNumCities();
+#ifdef AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+	// city best yields are about to change, so scores from earlier this turn are no longer valid
+	ResetSharedPlotBuildScores();
+#endif // AUI_WORKER_SHARED_PLOT_BUILD_SCORES
 
 	int iLoop;
 	CvCity* pCity;
@@ -1068,12 +1081,16 @@ void CvBuilderTaskingAI::AddImprovingResourcesDirectives(CvUnit* pUnit, CvPlot*
 		iWeight += GetResourceWeight(eResource, eImprovement, pPlot->getNumResource());
 		iWeight = CorrectWeight(iWeight);
 
+#ifdef AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+		int iScore = GetSharedPlotBuildScore(pPlot, eBuild, eFeatureType != NO_FEATURE && pkBuild->isFeatureRemove(eFeatureType) && pkBuild->getFeatureProduction(eFeatureType) > 0);
+#else
 		UpdateProjectedPlotYields(pPlot, eBuild);
 #ifdef AUI_WORKER_SCORE_PLOT_CHOP
 		int iScore = ScorePlot(eFeatureType != NO_FEATURE && pkBuild->isFeatureRemove(eFeatureType) && pkBuild->getFeatureProduction(eFeatureType) > 0);
 #else
 		int iScore = ScorePlot();
 #endif // AUI_WORKER_SCORE_PLOT_CHOP
+#endif // AUI_WORKER_SHARED_PLOT_BUILD_SCORES
 		if(iScore > 0)
 		{
 			iWeight *= iScore;
@@ -1379,12 +1396,16 @@ void CvBuilderTaskingAI::AddImprovingPlotsDirectives(CvUnit* pUnit, CvPlot* pPlo
 		int iScore = 0;
 		if (pCity)
 		{
+#ifdef AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+			iScore = GetSharedPlotBuildScore(pPlot, eBuild, bWillRemoveForestOrJungle && pkBuild->getFeatureProduction(eFeature) > 0);
+#else
 			UpdateProjectedPlotYields(pPlot, eBuild);
 #ifdef AUI_WORKER_SCORE_PLOT_CHOP
 			iScore = ScorePlot(bWillRemoveForestOrJungle && pkBuild->getFeatureProduction(eFeature) > 0);
 #else
 			iScore = ScorePlot();
 #endif // AUI_WORKER_SCORE_PLOT_CHOP
+#endif // AUI_WORKER_SHARED_PLOT_BUILD_SCORES
 		}
 		if (!pCity || iScore > 0)
 		{
@@ -1393,6 +1414,9 @@ void CvBuilderTaskingAI::AddImprovingPlotsDirectives(CvUnit* pUnit, CvPlot* pPlo
 				GC.getTerrainInfo(pPlot->getTerrainType())->getDefenseModifier() + GC.getFLAT_LAND_EXTRA_DEFENSE()));
 			iScore += (pImprovement->GetDefenseModifier() + iBaseDefenseBonus) * pPlot->getStrategicValue(false) / (100 * GC.getCHOKEPOINT_STRATEGIC_VALUE());
 		}
+#else
+#ifdef AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+		int iScore = GetSharedPlotBuildScore(pPlot, eBuild, bWillRemoveForestOrJungle && pkBuild->getFeatureProduction(eFeature) > 0);
 #else
 		UpdateProjectedPlotYields(pPlot, eBuild);
 #ifdef AUI_WORKER_SCORE_PLOT_CHOP
@@ -1400,6 +1424,7 @@ void CvBuilderTaskingAI::AddImprovingPlotsDirectives(CvUnit* pUnit, CvPlot* pPlo
 #else
 		int iScore = ScorePlot();
 #endif // AUI_WORKER_SCORE_PLOT_CHOP
+#endif // AUI_WORKER_SHARED_PLOT_BUILD_SCORES
 #endif // AUI_WORKER_ADD_IMPROVING_PLOTS_DIRECTIVE_DEFENSIVES
 
 		// if we're going backward, bail out!
@@ -3404,3 +3429,131 @@ void CvBuilderTaskingAI::UpdateProjectedPlotYields(CvPlot* pPlot, BuildTypes eBu
 		}
 	}
 }
+
+#ifdef AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+/// Starts a homeland worker pass: until EndSharedPlotBuildScores(), ScorePlot() results are shared between our workers
+void CvBuilderTaskingAI::BeginSharedPlotBuildScores()
+{
+	ResetSharedPlotBuildScores();
+	m_bSharedPlotBuildScoresActive = true;
+}
+
+/// Ends a homeland worker pass, scores computed outside of one (eg. for the UI's recommended actions) are never stored
+void CvBuilderTaskingAI::EndSharedPlotBuildScores()
+{
+	ResetSharedPlotBuildScores();
+	m_bSharedPlotBuildScoresActive = false;
+}
+
+/// Returns ScorePlot() for the plot with the build applied, reusing the value another of our workers computed earlier in this pass if neither the plot's yields nor anything else ScorePlot() reads have changed since
+int CvBuilderTaskingAI::GetSharedPlotBuildScore(CvPlot* pPlot, BuildTypes eBuild, bool bWillChop)
+{
+	if(pPlot != m_pTargetPlot)
+	{
+		UpdateCurrentPlotYields(pPlot);
+	}
+
+#ifndef AUI_WORKER_SCORE_PLOT_CHOP
+	bWillChop = false;
+#endif // AUI_WORKER_SCORE_PLOT_CHOP
+
+	if(!m_bSharedPlotBuildScoresActive)
+	{
+		UpdateProjectedPlotYields(pPlot, eBuild);
+#ifdef AUI_WORKER_SCORE_PLOT_CHOP
+		return ScorePlot(bWillChop);
+#else
+		return ScorePlot();
+#endif // AUI_WORKER_SCORE_PLOT_CHOP
+	}
+
+	int iKey = (pPlot->GetPlotIndex() * GC.getNumBuildInfos() + (int)eBuild) * 2 + (bWillChop ? 1 : 0);
+	PlotBuildScoreContext kContext;
+	GetPlotBuildScoreContext(pPlot, kContext);
+
+	PlotBuildScoreMap::iterator it = m_PlotBuildScores.find(iKey);
+	if(it != m_PlotBuildScores.end() && it->second.m_kContext == kContext)
+	{
+		bool bYieldsChanged = false;
+		for(uint ui = 0; ui < NUM_YIELD_TYPES; ui++)
+		{
+			if(it->second.m_aiCurrentPlotYields[ui] != m_aiCurrentPlotYields[ui])
+			{
+				bYieldsChanged = true;
+				break;
+			}
+		}
+
+		if(!bYieldsChanged)
+		{
+			return it->second.m_iScore;
+		}
+	}
+
+	UpdateProjectedPlotYields(pPlot, eBuild);
+#ifdef AUI_WORKER_SCORE_PLOT_CHOP
+	int iScore = ScorePlot(bWillChop);
+#else
+	int iScore = ScorePlot();
+#endif // AUI_WORKER_SCORE_PLOT_CHOP
+
+	PlotBuildScoreEntry& kEntry = m_PlotBuildScores[iKey];
+	kEntry.m_kContext = kContext;
+	for(uint ui = 0; ui < NUM_YIELD_TYPES; ui++)
+	{
+		kEntry.m_aiCurrentPlotYields[ui] = m_aiCurrentPlotYields[ui];
+	}
+	kEntry.m_iScore = iScore;
+
+	return iScore;
+}
+
+/// Collects the city and player state ScorePlot() reads for pPlot (workers can change some of it mid-pass, eg. gold when an idle worker is scrapped)
+void CvBuilderTaskingAI::GetPlotBuildScoreContext(CvPlot* pPlot, PlotBuildScoreContext& kContext) const
+{
+	CvCity* pCity = pPlot->getWorkingCity();
+	kContext.m_eWorkingCityOwner = pCity ? pCity->getOwner() : NO_PLAYER;
+	kContext.m_iWorkingCityID = pCity ? pCity->GetID() : -1;
+	kContext.m_bRazing = pCity ? pCity->IsRazing() : false;
+	kContext.m_eFocusYield = pCity ? pCity->GetCityStrategyAI()->GetFocusYield() : NO_YIELD;
+	kContext.m_eFocusType = pCity ? pCity->GetCityCitizens()->GetFocusType() : NO_CITY_AI_FOCUS_TYPE;
+	kContext.m_iFoodSurplus = pCity ? pCity->getYieldRate(YIELD_FOOD, false) - pCity->foodConsumption() : 0;
+	kContext.m_iFoodSurplusWithTrade = pCity ? pCity->getYieldRate(YIELD_FOOD, true) - pCity->foodConsumption() : 0;
+	kContext.m_bIgnoreCityForHappiness = pCity ? pCity->IsIgnoreCityForHappiness() : false;
+	for(uint ui = 0; ui < NUM_YIELD_TYPES; ui++)
+	{
+		kContext.m_aiYieldDeltaTimes100[ui] = pCity ? pCity->GetCityStrategyAI()->GetYieldDeltaTimes100((YieldTypes)ui) : 0;
+	}
+
+	CvPlayer& kCityOwner = pCity ? GET_PLAYER(pCity->getOwner()) : *m_pPlayer;
+	kContext.m_iExcessHappiness = kCityOwner.GetExcessHappiness();
+	kContext.m_bLosingMoney = kCityOwner.GetEconomicAI()->IsUsingStrategy((EconomicAIStrategyTypes)GC.getInfoTypeForString("ECONOMICAISTRATEGY_LOSING_MONEY"));
+	kContext.m_bNoGold = kCityOwner.GetTreasury()->GetGold() < 1;
+}
+
+bool CvBuilderTaskingAI::PlotBuildScoreContext::operator==(const PlotBuildScoreContext& kOther) const
+{
+	if(m_eWorkingCityOwner != kOther.m_eWorkingCityOwner || m_iWorkingCityID != kOther.m_iWorkingCityID || m_bRazing != kOther.m_bRazing)
+		return false;
+	if(m_eFocusYield != kOther.m_eFocusYield || m_eFocusType != kOther.m_eFocusType)
+		return false;
+	if(m_iFoodSurplus != kOther.m_iFoodSurplus || m_iFoodSurplusWithTrade != kOther.m_iFoodSurplusWithTrade)
+		return false;
+	if(m_bIgnoreCityForHappiness != kOther.m_bIgnoreCityForHappiness || m_iExcessHappiness != kOther.m_iExcessHappiness)
+		return false;
+	if(m_bLosingMoney != kOther.m_bLosingMoney || m_bNoGold != kOther.m_bNoGold)
+		return false;
+	for(uint ui = 0; ui < NUM_YIELD_TYPES; ui++)
+	{
+		if(m_aiYieldDeltaTimes100[ui] != kOther.m_aiYieldDeltaTimes100[ui])
+			return false;
+	}
+	return true;
+}
+
+/// Forgets all shared plot scores, they will be recomputed the next time a worker asks for them
+void CvBuilderTaskingAI::ResetSharedPlotBuildScores()
+{
+	m_PlotBuildScores.clear();
+}
+#endif // AUI_WORKER_SHARED_PLOT_BUILD_SCORES
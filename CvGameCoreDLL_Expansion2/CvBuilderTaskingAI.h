@@ -75,6 +75,10 @@ public:
 	void UpdateRoutePlots(void);
 
 	bool EvaluateBuilder(CvUnit* pUnit, BuilderDirective* paDirectives, UINT uaDirectives, bool bKeepOnlyBest = false, bool bOnlyEvaluateWorkersPlot = false);
+#ifdef AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+	void BeginSharedPlotBuildScores();
+	void EndSharedPlotBuildScores();
+#endif // AUI_WORKER_SHARED_PLOT_BUILD_SCORES
 
 	void AddImprovingResourcesDirectives(CvUnit* pUnit, CvPlot* pPlot, int iMoveTurnsAway);
 	void AddImprovingPlotsDirectives(CvUnit* pUnit, CvPlot* pPlot, int iMoveTurnsAway);
@@ -128,6 +132,10 @@ protected:
 
 	void UpdateCurrentPlotYields(CvPlot* pPlot);
 	void UpdateProjectedPlotYields(CvPlot* pPlot, BuildTypes eBuild);
+#ifdef AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+	int GetSharedPlotBuildScore(CvPlot* pPlot, BuildTypes eBuild, bool bWillChop);
+	void ResetSharedPlotBuildScores();
+#endif // AUI_WORKER_SHARED_PLOT_BUILD_SCORES
 
 	CvPlayer* m_pPlayer;
 	BuildTypes m_eRepairBuild;
@@ -138,6 +146,37 @@ protected:
 	CvPlot* m_pTargetPlot;
 	int m_aiCurrentPlotYields[NUM_YIELD_TYPES];
 	int m_aiProjectedPlotYields[NUM_YIELD_TYPES];
+#ifdef AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+	// Everything ScorePlot() reads besides the plot's own yields, a shared score is only reused if none of it has changed
+	struct PlotBuildScoreContext
+	{
+		PlayerTypes m_eWorkingCityOwner;
+		int m_iWorkingCityID;
+		bool m_bRazing;
+		YieldTypes m_eFocusYield;
+		CityAIFocusTypes m_eFocusType;
+		int m_iFoodSurplus;
+		int m_iFoodSurplusWithTrade;
+		bool m_bIgnoreCityForHappiness;
+		int m_iExcessHappiness;
+		bool m_bLosingMoney;
+		bool m_bNoGold;
+		int m_aiYieldDeltaTimes100[NUM_YIELD_TYPES];
+
+		bool operator==(const PlotBuildScoreContext& kOther) const;
+	};
+	// ScorePlot() results shared by all workers during one homeland worker pass, keyed by plot, build and chop flag
+	struct PlotBuildScoreEntry
+	{
+		PlotBuildScoreContext m_kContext;
+		int m_aiCurrentPlotYields[NUM_YIELD_TYPES];
+		int m_iScore;
+	};
+	typedef stdext::hash_map<int, PlotBuildScoreEntry> PlotBuildScoreMap;
+	void GetPlotBuildScoreContext(CvPlot* pPlot, PlotBuildScoreContext& kContext) const;
+	PlotBuildScoreMap m_PlotBuildScores;
+	bool m_bSharedPlotBuildScoresActive;
+#endif // AUI_WORKER_SHARED_PLOT_BUILD_SCORES
 
 	FeatureTypes m_eFalloutFeature;
 	BuildTypes m_eFalloutRemove;
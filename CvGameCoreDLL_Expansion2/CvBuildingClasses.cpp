@@ -2053,6 +2053,9 @@ CvCityBuildings::CvCityBuildings():
 	m_iLandmarksTourismPercent(0),
 	m_iGreatWorksTourismModifier(0),
 	m_bSoldBuildingThisTurn(false),
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	m_iBuildingsEpoch(0),
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 	m_pBuildings(NULL),
 	m_pCity(NULL)
 {
@@ -2126,6 +2129,9 @@ void CvCityBuildings::Reset()
 	m_iGreatWorksTourismModifier = 0;
 
 	m_bSoldBuildingThisTurn = false;
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	m_iBuildingsEpoch++;
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 
 	for(iI = 0; iI < m_pBuildings->GetNumBuildings(); iI++)
 	{
@@ -2527,6 +2533,15 @@ void CvCityBuildings::SetNumRealBuildingTimed(BuildingTypes eIndex, int iNewValu
 		int iOldNumBuilding = GetNumBuilding(eIndex);
 
 		m_paiNumRealBuilding[eIndex] = iNewValue;
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+		m_iBuildingsEpoch++;
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+		if(isWorldWonderClass(kBuildingClassInfo))
+		{
+			GC.getGame().BumpWorldWonderEpoch();
+		}
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 		if(GetNumRealBuilding(eIndex) > 0)
 		{
@@ -2752,6 +2767,16 @@ void CvCityBuildings::SetNumFreeBuilding(BuildingTypes eIndex, int iNewValue)
 	if (GetNumFreeBuilding(eIndex) != iNewValue)
 	{
 		int iOldNumBuilding = GetNumBuilding(eIndex);
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+		m_iBuildingsEpoch++;
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+		CvBuildingEntry* pkFreeBuildingInfo = GC.getBuildingInfo(eIndex);
+		if(pkFreeBuildingInfo && isWorldWonderClass(pkFreeBuildingInfo->GetBuildingClassInfo()))
+		{
+			GC.getGame().BumpWorldWonderEpoch();
+		}
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 		if (iOldNumBuilding > 0 && iNewValue > 0)
 		{
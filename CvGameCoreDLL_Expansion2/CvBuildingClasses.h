@@ -554,6 +554,12 @@ public:
 
 	bool IsSoldBuildingThisTurn() const;
 	void SetSoldBuildingThisTurn(bool bValue);
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	int GetBuildingsEpoch() const
+	{
+		return m_iBuildingsEpoch;
+	};
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 
 	int GetTotalBaseBuildingMaintenance() const;
 
@@ -637,6 +643,9 @@ private:
 	int m_iGreatWorksTourismModifier;
 
 	bool m_bSoldBuildingThisTurn;
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	int m_iBuildingsEpoch; // changes whenever the number of any building changes, not saved
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 
 	int* m_paiBuildingProduction;
 	int* m_paiBuildingProductionTime;
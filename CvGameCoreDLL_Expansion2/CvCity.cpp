@@ -659,6 +659,13 @@ void CvCity::uninit()
 void CvCity::reset(int iID, PlayerTypes eOwner, int iX, int iY, bool bConstructorCall)
 {
 	VALIDATE_OBJECT
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+	// Fields below are written directly, so take this city's old contribution out of the rolling checksum first (a reset city contributes nothing)
+	if(!bConstructorCall)
+	{
+		GC.getGame().updateRollingSyncChecksum(ROLLING_SYNC_CHECKSUM_CITIES, GetRollingSyncChecksum(), 0);
+	}
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
 	m_syncArchive.reset();
 
 	int iI;
@@ -670,6 +677,9 @@ void CvCity::reset(int iID, PlayerTypes eOwner, int iX, int iY, bool bConstructo
 	m_iID = iID;
 	m_iX = iX;
 	m_iY = iY;
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	m_eCountedProductionUnit = NO_UNIT;
+#endif // AUI_PLAYER_UNIT_COUNTERS
 	m_iRallyX = INVALID_PLOT_COORD;
 	m_iRallyY = INVALID_PLOT_COORD;
 	m_iGameTurnFounded = 0;
@@ -7179,7 +7189,13 @@ void CvCity::setPopulation(int iNewValue, bool bReassignPop /* = true */)
 			}
 		}
 
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+		uint uiOldSyncChecksum = GetRollingSyncChecksum();
 		m_iPopulation = iNewValue;
+		GC.getGame().updateRollingSyncChecksum(ROLLING_SYNC_CHECKSUM_CITIES, uiOldSyncChecksum, GetRollingSyncChecksum());
+#else
+		m_iPopulation = iNewValue;
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
 
 		CvAssert(getPopulation() >= 0);
 
@@ -7268,6 +7284,23 @@ void CvCity::changePopulation(int iChange, bool bReassignPop)
 	GetCityReligions()->DoPopulationChange(iChange);
 }
 
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+//	--------------------------------------------------------------------------------
+/// This city's contribution to the game's rolling sync checksum (cities being razed or killed are set to 0 population and contribute nothing)
+uint CvCity::GetRollingSyncChecksum() const
+{
+	VALIDATE_OBJECT
+	if(m_iPopulation == 0)
+		return 0;
+
+	uint uiHash = ROLLING_SYNC_CHECKSUM_SEED;
+	uiHash = RollingSyncChecksumMix(uiHash, getOwner());
+	uiHash = RollingSyncChecksumMix(uiHash, GetID());
+	uiHash = RollingSyncChecksumMix(uiHash, m_iPopulation);
+	return uiHash;
+}
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
+
 
 //	--------------------------------------------------------------------------------
 long CvCity::getRealPopulation() const
@@ -11572,6 +11605,9 @@ void CvCity::pushOrder(OrderTypes eOrder, int iData1, int iData2, bool bSave, bo
 	{
 		startHeadOrder();
 	}
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	UpdateOwnerProductionUnitCounters();
+#endif // AUI_PLAYER_UNIT_COUNTERS
 
 	if((getTeam() == GC.getGame().getActiveTeam()) || GC.getGame().isDebugMode())
 	{
@@ -11896,6 +11932,9 @@ void CvCity::popOrder(int iNum, bool bFinish, bool bChoose)
 	{
 		startHeadOrder();
 	}
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	UpdateOwnerProductionUnitCounters();
+#endif // AUI_PLAYER_UNIT_COUNTERS
 
 	if((getTeam() == GC.getGame().getActiveTeam()) || GC.getGame().isDebugMode())
 	{
@@ -11991,6 +12030,9 @@ void CvCity::swapOrder(int iNum)
 	{
 		startHeadOrder();
 	}
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	UpdateOwnerProductionUnitCounters();
+#endif // AUI_PLAYER_UNIT_COUNTERS
 
 	if((getTeam() == GC.getGame().getActiveTeam()) || GC.getGame().isDebugMode())
 	{
@@ -12006,6 +12048,33 @@ void CvCity::swapOrder(int iNum)
 }
 
 
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+//	--------------------------------------------------------------------------------
+/// Tells the owner which unit (if any) is now at the head of our production queue so its units being trained counters stay correct
+void CvCity::UpdateOwnerProductionUnitCounters(bool bRemoveOnly, bool bOwnerCountersReset)
+{
+	VALIDATE_OBJECT
+	UnitTypes eProductionUnit = (!bRemoveOnly && isProductionUnit()) ? getProductionUnit() : NO_UNIT;
+	if(bOwnerCountersReset)
+	{
+		m_eCountedProductionUnit = NO_UNIT;
+	}
+
+	if(eProductionUnit != m_eCountedProductionUnit)
+	{
+		CvPlayer& kOwner = GET_PLAYER(getOwner());
+		if(m_eCountedProductionUnit != NO_UNIT)
+		{
+			kOwner.ChangeNumUnitsBeingTrained(m_eCountedProductionUnit, -1);
+		}
+		if(eProductionUnit != NO_UNIT)
+		{
+			kOwner.ChangeNumUnitsBeingTrained(eProductionUnit, 1);
+		}
+		m_eCountedProductionUnit = eProductionUnit;
+	}
+}
+
 //	--------------------------------------------------------------------------------
 void CvCity::startHeadOrder()
 {
@@ -13299,6 +13368,9 @@ bool CvCity::doCheckProduction()
 
 						pOrderNode = nextOrderQueueNode(pOrderNode);
 					}
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+					UpdateOwnerProductionUnitCounters();
+#endif // AUI_PLAYER_UNIT_COUNTERS
 				}
 			}
 		}
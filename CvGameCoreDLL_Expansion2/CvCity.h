@@ -314,6 +314,9 @@ public:
 	int getPopulation() const;
 	void setPopulation(int iNewValue, bool bReassignPop = true);
 	void changePopulation(int iChange, bool bReassignPop = true);
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+	uint GetRollingSyncChecksum() const;
+#endif
 
 	long getRealPopulation() const;
 
@@ -728,6 +731,9 @@ public:
 	void pushOrder(OrderTypes eOrder, int iData1, int iData2, bool bSave, bool bPop, bool bAppend, bool bRush=false);
 	void popOrder(int iNum, bool bFinish = false, bool bChoose = false);
 	void swapOrder(int iNum);
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	void UpdateOwnerProductionUnitCounters(bool bRemoveOnly = false, bool bOwnerCountersReset = false);
+#endif // AUI_PLAYER_UNIT_COUNTERS
 	void startHeadOrder();
 	void stopHeadOrder();
 	int getOrderQueueLength();
@@ -949,6 +955,9 @@ protected:
 	bool m_bOwedCultureBuilding;
 
 	mutable FFastSmallFixedList< OrderData, 25, true, c_eCiv5GameplayDLL > m_orderQueue;
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	UnitTypes m_eCountedProductionUnit; // head of the queue as last reported to the owner's units being trained counters (not saved)
+#endif // AUI_PLAYER_UNIT_COUNTERS
 
 	int** m_aaiBuildingSpecialistUpgradeProgresses;
 	int** m_ppaiResourceYieldChange;
@@ -315,6 +315,10 @@ void CvCityStrategyAI::Reset()
 	m_pUnitProductionAI->Reset();
 	m_pProjectProductionAI->Reset();
 	m_pProcessProductionAI->Reset();
+
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	ResetBuildableCandidates();
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 }
 
 /// Serialization read
@@ -342,6 +346,10 @@ void CvCityStrategyAI::Read(FDataStream& kStream)
 	m_pUnitProductionAI->Read(kStream);
 	m_pProjectProductionAI->Read(kStream);
 	m_pProcessProductionAI->Read(kStream);
+
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	ResetBuildableCandidates();
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 }
 
 /// Serialization write
@@ -842,8 +850,15 @@ void CvCityStrategyAI::ChooseProduction(bool bUseAsyncRandom, BuildingTypes eIgn
 	}
 
 	// Loop through adding the available buildings
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	UpdateBuildableCandidates();
+	for(uint uiCandidate = 0; uiCandidate < m_aiBuildingCandidates.size(); uiCandidate++)
+	{
+		iBldgLoop = m_aiBuildingCandidates[uiCandidate];
+#else
 	for(iBldgLoop = 0; iBldgLoop < GC.GetGameBuildings()->GetNumBuildings(); iBldgLoop++)
 	{
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 		const BuildingTypes eLoopBuilding = static_cast<BuildingTypes>(iBldgLoop);
 		CvBuildingEntry* pkBuildingInfo = GC.getBuildingInfo(eLoopBuilding);
 
@@ -957,8 +972,14 @@ void CvCityStrategyAI::ChooseProduction(bool bUseAsyncRandom, BuildingTypes eIgn
 		CvCity* pLoopCity = NULL;
 #endif // AUI_CITYSTRATEGY_FIX_CHOOSE_PRODUCTION_ACCURATE_SEA_SANITY_CHECK
 		// Loop through adding the available units
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+		for(uint uiCandidate = 0; uiCandidate < m_aiUnitCandidates.size(); uiCandidate++)
+		{
+			iUnitLoop = m_aiUnitCandidates[uiCandidate];
+#else
 		for(iUnitLoop = 0; iUnitLoop < GC.GetGameUnits()->GetNumUnits(); iUnitLoop++)
 		{
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 			// Make sure this unit can be built now
 			if(iUnitLoop != eIgnoreUnit &&
 			        //GC.GetGameBuildings()->GetEntry(iUnitLoop)->GetAdvisorType() != eIgnoreAdvisor &&
@@ -1045,8 +1066,14 @@ void CvCityStrategyAI::ChooseProduction(bool bUseAsyncRandom, BuildingTypes eIgn
 		}
 
 		// Loop through adding the available projects
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+		for(uint uiCandidate = 0; uiCandidate < m_aiProjectCandidates.size(); uiCandidate++)
+		{
+			iProjectLoop = m_aiProjectCandidates[uiCandidate];
+#else
 		for(iProjectLoop = 0; iProjectLoop < GC.GetGameProjects()->GetNumProjects(); iProjectLoop++)
 		{
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 			if(m_pCity->canCreate((ProjectTypes)iProjectLoop))
 			{
 				buildable.m_eBuildableType = CITY_BUILDABLE_PROJECT;
@@ -1092,6 +1119,8 @@ void CvCityStrategyAI::ChooseProduction(bool bUseAsyncRandom, BuildingTypes eIgn
 
 #ifdef AUI_CITYSTRATEGY_CHOOSE_PRODUCTION_NORMALIZE_LIST
 	NormalizeList();
+#elif defined(AUI_WEIGHTED_VECTOR_PARTIAL_SORT_TOP_CHOICES)
+	m_Buildables.StableSortTopItems(GC.getGame().getHandicapInfo().GetCityProductionNumOptions());
 #else
 	m_Buildables.SortItems();
 #endif // AUI_CITYSTRATEGY_CHOOSE_PRODUCTION_NORMALIZE_LIST
@@ -1161,6 +1190,331 @@ void CvCityStrategyAI::ChooseProduction(bool bUseAsyncRandom, BuildingTypes eIgn
 	return;
 }
 
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+/// Forgets the cached candidate lists, they are rebuilt the next time ChooseProduction() runs
+void CvCityStrategyAI::ResetBuildableCandidates()
+{
+	m_aiBuildingCandidates.clear();
+	m_aiUnitCandidates.clear();
+	m_aiProjectCandidates.clear();
+	m_bBuildableCandidatesValid = false;
+	m_eBuildableCandidatesTeam = NO_TEAM;
+	m_bBuildableCandidatesHuman = false;
+	m_iBuildableCandidatesTeamEpoch = 0;
+	m_iBuildableCandidatesPlayerEpoch = 0;
+	m_iBuildableCandidatesCityEpoch = 0;
+}
+
+/// Refilters the buildings, units and projects this city could ever pass canConstruct(), canTrain() and canCreate() for, but only if the team's techs, the player's policies or the city's buildings have changed since last time
+void CvCityStrategyAI::UpdateBuildableCandidates()
+{
+	CvPlayer& kPlayer = GET_PLAYER(m_pCity->getOwner());
+	TeamTypes eTeam = kPlayer.getTeam();
+	bool bHuman = kPlayer.isHuman();
+	int iTeamEpoch = GET_TEAM(eTeam).GetBuildableEpoch();
+	int iPlayerEpoch = kPlayer.GetBuildableEpoch();
+	int iCityEpoch = m_pCity->GetCityBuildings()->GetBuildingsEpoch();
+
+	bool bUpToDate = m_bBuildableCandidatesValid && m_eBuildableCandidatesTeam == eTeam && m_bBuildableCandidatesHuman == bHuman &&
+		m_iBuildableCandidatesTeamEpoch == iTeamEpoch && m_iBuildableCandidatesPlayerEpoch == iPlayerEpoch && m_iBuildableCandidatesCityEpoch == iCityEpoch;
+
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE_VALIDATE
+	std::vector<int> aiCachedBuildings = m_aiBuildingCandidates;
+	std::vector<int> aiCachedUnits = m_aiUnitCandidates;
+	std::vector<int> aiCachedProjects = m_aiProjectCandidates;
+#else
+	if(bUpToDate)
+	{
+		return;
+	}
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE_VALIDATE
+
+	int iI;
+	m_aiBuildingCandidates.clear();
+	for(iI = 0; iI < GC.GetGameBuildings()->GetNumBuildings(); iI++)
+	{
+		if(IsBuildingCandidate((BuildingTypes)iI))
+		{
+			m_aiBuildingCandidates.push_back(iI);
+		}
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE_VALIDATE
+		else
+		{
+			CvAssertMsg(!m_pCity->canConstruct((BuildingTypes)iI), "Buildable candidate filter rejected a building the city can construct");
+		}
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE_VALIDATE
+	}
+
+	m_aiUnitCandidates.clear();
+	for(iI = 0; iI < GC.GetGameUnits()->GetNumUnits(); iI++)
+	{
+		if(IsUnitCandidate((UnitTypes)iI))
+		{
+			m_aiUnitCandidates.push_back(iI);
+		}
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE_VALIDATE
+		else
+		{
+			CvAssertMsg(!m_pCity->canTrain((UnitTypes)iI), "Buildable candidate filter rejected a unit the city can train");
+		}
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE_VALIDATE
+	}
+
+	m_aiProjectCandidates.clear();
+	for(iI = 0; iI < GC.GetGameProjects()->GetNumProjects(); iI++)
+	{
+		if(IsProjectCandidate((ProjectTypes)iI))
+		{
+			m_aiProjectCandidates.push_back(iI);
+		}
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE_VALIDATE
+		else
+		{
+			CvAssertMsg(!m_pCity->canCreate((ProjectTypes)iI), "Buildable candidate filter rejected a project the city can create");
+		}
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE_VALIDATE
+	}
+
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE_VALIDATE
+	if(bUpToDate)
+	{
+		CvAssertMsg(aiCachedBuildings == m_aiBuildingCandidates, "Cached building candidates are stale");
+		CvAssertMsg(aiCachedUnits == m_aiUnitCandidates, "Cached unit candidates are stale");
+		CvAssertMsg(aiCachedProjects == m_aiProjectCandidates, "Cached project candidates are stale");
+	}
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE_VALIDATE
+
+	m_bBuildableCandidatesValid = true;
+	m_eBuildableCandidatesTeam = eTeam;
+	m_bBuildableCandidatesHuman = bHuman;
+	m_iBuildableCandidatesTeamEpoch = iTeamEpoch;
+	m_iBuildableCandidatesPlayerEpoch = iPlayerEpoch;
+	m_iBuildableCandidatesCityEpoch = iCityEpoch;
+}
+
+/// Cheap subset of CvPlayer::canConstruct() and CvCity::canConstruct(): only checks that must fail there too, and only on inputs that bump the epochs in UpdateBuildableCandidates()
+bool CvCityStrategyAI::IsBuildingCandidate(BuildingTypes eBuilding) const
+{
+	CvBuildingEntry* pkBuildingInfo = GC.getBuildingInfo(eBuilding);
+	if(pkBuildingInfo == NULL)
+	{
+		return false;
+	}
+
+	CvPlayer& kPlayer = GET_PLAYER(m_pCity->getOwner());
+	CvTeam& kTeam = GET_TEAM(kPlayer.getTeam());
+	CvCivilizationInfo& kCityCivInfo = m_pCity->getCivilizationInfo();
+	CvCityBuildings* pCityBuildings = m_pCity->GetCityBuildings();
+	int iI;
+
+	if(GC.getGame().isOption(GAMEOPTION_NO_ESPIONAGE) && pkBuildingInfo->IsEspionage())
+	{
+		return false;
+	}
+
+	if(kPlayer.getCivilizationInfo().getCivilizationBuildings(pkBuildingInfo->GetBuildingClassType()) != eBuilding)
+	{
+		return false;
+	}
+
+	if(pkBuildingInfo->GetProductionCost() == -1)
+	{
+		return false;
+	}
+
+	PolicyBranchTypes eBranch = (PolicyBranchTypes)pkBuildingInfo->GetPolicyBranchType();
+	if(eBranch != NO_POLICY_BRANCH_TYPE && !kPlayer.GetPlayerPolicies()->IsPolicyBranchUnlocked(eBranch))
+	{
+		return false;
+	}
+
+	if(!kTeam.GetTeamTechs()->HasTech((TechTypes)pkBuildingInfo->GetPrereqAndTech()))
+	{
+		return false;
+	}
+
+	for(iI = 0; iI < GC.getNUM_BUILDING_AND_TECH_PREREQS(); iI++)
+	{
+		if(pkBuildingInfo->GetPrereqAndTechs(iI) != NO_TECH && !kTeam.GetTeamTechs()->HasTech((TechTypes)pkBuildingInfo->GetPrereqAndTechs(iI)))
+		{
+			return false;
+		}
+	}
+
+	if(kTeam.isObsoleteBuilding(eBuilding))
+	{
+		return false;
+	}
+
+	if(pCityBuildings->GetNumBuilding(eBuilding) >= GC.getCITY_MAX_NUM_BUILDINGS())
+	{
+		return false;
+	}
+
+	int iNumBuildingClassInfos = GC.getNumBuildingClassInfos();
+	for(iI = 0; iI < iNumBuildingClassInfos; iI++)
+	{
+		if(GC.getBuildingClassInfo((BuildingClassTypes)iI) == NULL)
+		{
+			continue;
+		}
+
+		if(pkBuildingInfo->IsBuildingClassNeededInCity(iI))
+		{
+			BuildingTypes ePrereqBuilding = (BuildingTypes)kCityCivInfo.getCivilizationBuildings(iI);
+			if(ePrereqBuilding != NO_BUILDING && pCityBuildings->GetNumBuilding(ePrereqBuilding) == 0)
+			{
+				return false;
+			}
+		}
+	}
+
+	for(iI = 0; iI < iNumBuildingClassInfos; iI++)
+	{
+		BuildingClassTypes eLockedBuildingClass = (BuildingClassTypes)pkBuildingInfo->GetLockedBuildingClasses(iI);
+		if(eLockedBuildingClass != NO_BUILDINGCLASS)
+		{
+			BuildingTypes eLockedBuilding = (BuildingTypes)kCityCivInfo.getCivilizationBuildings(eLockedBuildingClass);
+			if(eLockedBuilding != NO_BUILDING && pCityBuildings->GetNumBuilding(eLockedBuilding) > 0)
+			{
+				return false;
+			}
+		}
+	}
+
+	if(pkBuildingInfo->GetMutuallyExclusiveGroup() != -1)
+	{
+		for(iI = 0; iI < GC.getNumBuildingInfos(); iI++)
+		{
+			CvBuildingEntry* pkLoopBuilding = GC.getBuildingInfo((BuildingTypes)iI);
+			if(pkLoopBuilding && pkLoopBuilding->GetMutuallyExclusiveGroup() == pkBuildingInfo->GetMutuallyExclusiveGroup() && pCityBuildings->GetNumBuilding((BuildingTypes)iI) > 0)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/// Cheap subset of CvPlayer::canTrain() and CvCity::canTrain(), same rules as IsBuildingCandidate()
+bool CvCityStrategyAI::IsUnitCandidate(UnitTypes eUnit) const
+{
+	CvUnitEntry* pkUnitInfo = GC.getUnitInfo(eUnit);
+	if(pkUnitInfo == NULL)
+	{
+		return false;
+	}
+
+	CvPlayer& kPlayer = GET_PLAYER(m_pCity->getOwner());
+	CvTeam& kTeam = GET_TEAM(kPlayer.getTeam());
+	int iI;
+
+	const UnitClassTypes eUnitClass = (UnitClassTypes)pkUnitInfo->GetUnitClassType();
+	if(eUnitClass == NO_UNITCLASS || GC.getUnitClassInfo(eUnitClass) == NULL)
+	{
+		return false;
+	}
+
+	if(kPlayer.getCivilizationInfo().getCivilizationUnits(eUnitClass) != eUnit)
+	{
+		return false;
+	}
+
+	if(pkUnitInfo->GetProductionCost() == -1 || pkUnitInfo->IsPurchaseOnly())
+	{
+		return false;
+	}
+
+	if((pkUnitInfo->IsFound() || pkUnitInfo->IsFoundAbroad()) && GC.getGame().isOption(GAMEOPTION_ONE_CITY_CHALLENGE) && kPlayer.isHuman())
+	{
+		return false;
+	}
+
+	PolicyTypes ePolicy = (PolicyTypes)pkUnitInfo->GetPolicyType();
+	if(ePolicy != NO_POLICY && !kPlayer.GetPlayerPolicies()->HasPolicy(ePolicy))
+	{
+		return false;
+	}
+
+	if(GC.getGame().isOption(GAMEOPTION_NO_RELIGION) && (pkUnitInfo->IsFoundReligion() || pkUnitInfo->IsSpreadReligion() || pkUnitInfo->IsRemoveHeresy()))
+	{
+		return false;
+	}
+
+	if(!kTeam.GetTeamTechs()->HasTech((TechTypes)pkUnitInfo->GetPrereqAndTech()))
+	{
+		return false;
+	}
+
+	for(iI = 0; iI < GC.getNUM_UNIT_AND_TECH_PREREQS(); iI++)
+	{
+		if(pkUnitInfo->GetPrereqAndTechs(iI) != NO_TECH && !kTeam.GetTeamTechs()->HasTech((TechTypes)pkUnitInfo->GetPrereqAndTechs(iI)))
+		{
+			return false;
+		}
+	}
+
+	if((TechTypes)pkUnitInfo->GetObsoleteTech() != NO_TECH && kTeam.GetTeamTechs()->HasTech((TechTypes)pkUnitInfo->GetObsoleteTech()))
+	{
+		return false;
+	}
+
+	CvCivilizationInfo& kCivInfo = m_pCity->getCivilizationInfo();
+	for(iI = 0; iI < GC.getNumBuildingClassInfos(); iI++)
+	{
+		if(GC.getBuildingClassInfo((BuildingClassTypes)iI) == NULL)
+		{
+			continue;
+		}
+
+		if(pkUnitInfo->GetBuildingClassRequireds((BuildingClassTypes)iI))
+		{
+			BuildingTypes ePrereqBuilding = (BuildingTypes)kCivInfo.getCivilizationBuildings((BuildingClassTypes)iI);
+			if(GC.getBuildingInfo(ePrereqBuilding) != NULL && m_pCity->GetCityBuildings()->GetNumBuilding(ePrereqBuilding) == 0)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/// Cheap subset of CvPlayer::canCreate(), same rules as IsBuildingCandidate()
+bool CvCityStrategyAI::IsProjectCandidate(ProjectTypes eProject) const
+{
+	CvProjectEntry* pkProjectInfo = GC.getProjectInfo(eProject);
+	if(pkProjectInfo == NULL)
+	{
+		return false;
+	}
+
+	CvPlayer& kPlayer = GET_PLAYER(m_pCity->getOwner());
+	if(kPlayer.isBarbarian() || kPlayer.isMinorCiv())
+	{
+		return false;
+	}
+
+	if(pkProjectInfo->GetProductionCost() == -1)
+	{
+		return false;
+	}
+
+	if(!GET_TEAM(kPlayer.getTeam()).GetTeamTechs()->HasTech((TechTypes)pkProjectInfo->GetTechPrereq()))
+	{
+		return false;
+	}
+
+	if(pkProjectInfo->GetCultureBranchesRequired() > 0 && kPlayer.GetPlayerPolicies()->GetNumPolicyBranchesFinished() < pkProjectInfo->GetCultureBranchesRequired())
+	{
+		return false;
+	}
+
+	return true;
+}
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+
 /// Called every turn to see what CityStrategies this City should using (or not)
 void CvCityStrategyAI::DoTurn()
 {
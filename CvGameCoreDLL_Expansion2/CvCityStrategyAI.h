@@ -204,6 +204,13 @@ private:
 #ifdef AUI_CITYSTRATEGY_CHOOSE_PRODUCTION_NORMALIZE_LIST
 	void NormalizeList();
 #endif // AUI_CITYSTRATEGY_CHOOSE_PRODUCTION_NORMALIZE_LIST
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	void ResetBuildableCandidates();
+	void UpdateBuildableCandidates();
+	bool IsBuildingCandidate(BuildingTypes eBuilding) const;
+	bool IsUnitCandidate(UnitTypes eUnit) const;
+	bool IsProjectCandidate(ProjectTypes eProject) const;
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 
 	// Logging functions
 	void LogFlavors(FlavorTypes eFlavor = NO_FLAVOR);
@@ -228,6 +235,18 @@ private:
 	CvProcessProductionAI* m_pProcessProductionAI;
 
 	CvWeightedVector<CvCityBuildable, (SAFE_ESTIMATE_NUM_BUILDINGS + SAFE_ESTIMATE_NUM_UNITS), true> m_Buildables;
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	// items that pass the Is*Candidate() filters, in ascending order, and the inputs they were filtered with (not saved)
+	std::vector<int> m_aiBuildingCandidates;
+	std::vector<int> m_aiUnitCandidates;
+	std::vector<int> m_aiProjectCandidates;
+	bool m_bBuildableCandidatesValid;
+	TeamTypes m_eBuildableCandidatesTeam;
+	bool m_bBuildableCandidatesHuman;
+	int m_iBuildableCandidatesTeamEpoch;
+	int m_iBuildableCandidatesPlayerEpoch;
+	int m_iBuildableCandidatesCityEpoch;
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 
 	static unsigned char  m_acBestYields[NUM_YIELD_TYPES][NUM_CITY_PLOTS];
 	unsigned short m_asBestYieldAverageTimes100[NUM_YIELD_TYPES];
@@ -12,6 +12,11 @@
 // must be included after all other headers
 #include "LintFree.h"
 
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CACHE_MAX_ROWS
+CvDatabaseUtility::MaxRowsMap CvDatabaseUtility::s_cachedMaxRows;
+bool CvDatabaseUtility::s_bCacheMaxRows = false;
+#endif
+
 CvDatabaseUtility::CvDatabaseUtility()
 {
 
@@ -274,6 +279,15 @@ bool CvDatabaseUtility::SetYields(int*& pYieldsArray,
 //------------------------------------------------------------------------------
 int CvDatabaseUtility::MaxRows(const char* szTableName)
 {
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CACHE_MAX_ROWS
+	if(s_bCacheMaxRows)
+	{
+		MaxRowsMap::const_iterator it = s_cachedMaxRows.find(szTableName);
+		if(it != s_cachedMaxRows.end())
+			return it->second;
+	}
+
+#endif
 	char szSQL[256] = {0};
 	sprintf_s(szSQL, "SELECT max(rowid) from %s", szTableName);
 	Database::Results kResults;
@@ -287,8 +301,27 @@ int CvDatabaseUtility::MaxRows(const char* szTableName)
 		}
 	}
 
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CACHE_MAX_ROWS
+	if(s_bCacheMaxRows)
+		s_cachedMaxRows[szTableName] = maxValue;
+
+#endif
 	return maxValue;
 }
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CACHE_MAX_ROWS
+//------------------------------------------------------------------------------
+void CvDatabaseUtility::BeginMaxRowsCaching()
+{
+	s_cachedMaxRows.clear();
+	s_bCacheMaxRows = true;
+}
+//------------------------------------------------------------------------------
+void CvDatabaseUtility::EndMaxRowsCaching()
+{
+	s_bCacheMaxRows = false;
+	s_cachedMaxRows.clear();
+}
+#endif
 //------------------------------------------------------------------------------
 const char* CvDatabaseUtility::GetErrorMessage() const
 {
@@ -95,6 +95,12 @@ void InitializeArray(T*& pArray, const char* szTableName, T default = (T)0);
 
 	//! Retrieves the maximum number of a given column for a given table.
 	int MaxRows(const char* szTableName);
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CACHE_MAX_ROWS
+
+	//! Begins/ends a window during which the database is not modified, so MaxRows() results can be shared by all utilities.
+	static void BeginMaxRowsCaching();
+	static void EndMaxRowsCaching();
+#endif
 
 	//! Returns the most recent database error message.
 	const char* GetErrorMessage() const;
@@ -102,6 +108,12 @@ void InitializeArray(T*& pArray, const char* szTableName, T default = (T)0);
 private:
 	typedef stdext::hash_map<std::string, Database::Results*> ResultsMap;
 	ResultsMap m_storedResults;
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CACHE_MAX_ROWS
+
+	typedef stdext::hash_map<std::string, int> MaxRowsMap;
+	static MaxRowsMap s_cachedMaxRows;
+	static bool s_bCacheMaxRows;
+#endif
 };
 
 //------------------------------------------------------------------------------
@@ -49,6 +49,10 @@ void CvDealAI::Uninit()
 void CvDealAI::Reset()
 {
 	m_iCachedValueOfPeaceWithHuman = 0;
+#ifdef AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE
+	m_TradeItemValueCache.clear();
+	m_iTradeItemValueCacheDepth = 0;
+#endif
 }
 
 /// Serialization read
@@ -566,9 +570,70 @@ bool CvDealAI::IsDealWithHumanAcceptable(CvDeal* pDeal, PlayerTypes eOtherPlayer
 	return false;
 }
 
+#ifdef AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE
+/// Game state cannot change while a deal is being put together, so trade item values are remembered until the matching EndTradeItemValueCaching() call
+void CvDealAI::BeginTradeItemValueCaching()
+{
+	m_iTradeItemValueCacheDepth++;
+}
+
+/// Forgets remembered trade item values once the outermost caller is done
+void CvDealAI::EndTradeItemValueCaching()
+{
+	CvAssertMsg(m_iTradeItemValueCacheDepth > 0, "DEAL_AI: Trade item value caching ended more often than it was started.");
+	m_iTradeItemValueCacheDepth--;
+	if(m_iTradeItemValueCacheDepth <= 0)
+	{
+		m_iTradeItemValueCacheDepth = 0;
+		m_TradeItemValueCache.clear();
+	}
+}
+
+bool CvDealAI::TradeItemValueKey::operator<(const TradeItemValueKey& rhs) const
+{
+	if(m_eItem != rhs.m_eItem)
+		return m_eItem < rhs.m_eItem;
+	if(m_eOtherPlayer != rhs.m_eOtherPlayer)
+		return m_eOtherPlayer < rhs.m_eOtherPlayer;
+	if(m_iData1 != rhs.m_iData1)
+		return m_iData1 < rhs.m_iData1;
+	if(m_iData2 != rhs.m_iData2)
+		return m_iData2 < rhs.m_iData2;
+	if(m_iData3 != rhs.m_iData3)
+		return m_iData3 < rhs.m_iData3;
+	if(m_iDuration != rhs.m_iDuration)
+		return m_iDuration < rhs.m_iDuration;
+	if(m_bFromMe != rhs.m_bFromMe)
+		return rhs.m_bFromMe;
+	if(m_bFlag1 != rhs.m_bFlag1)
+		return rhs.m_bFlag1;
+	return !m_bUseEvenValue && rhs.m_bUseEvenValue;
+}
+
+#endif // AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE
 /// Try to even out the value on both sides.  If bFavorMe is true we'll bias things in our favor if necessary
 bool CvDealAI::DoEqualizeDealWithHuman(CvDeal* pDeal, PlayerTypes eOtherPlayer, bool bDontChangeMyExistingItems, bool bDontChangeTheirExistingItems, bool& bDealGoodToBeginWith, bool& bCantMatchOffer)
 {
+#ifdef AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE
+	BeginTradeItemValueCaching();
+#ifdef AUI_VOTING_SCORE_CACHE
+	// Vote commitment values ask both sides' league AI for their desires
+	GetPlayer()->GetLeagueAI()->BeginScoreCaching();
+	GET_PLAYER(eOtherPlayer).GetLeagueAI()->BeginScoreCaching();
+#endif // AUI_VOTING_SCORE_CACHE
+	bool bResult = DoEqualizeDealWithHumanInternal(pDeal, eOtherPlayer, bDontChangeMyExistingItems, bDontChangeTheirExistingItems, bDealGoodToBeginWith, bCantMatchOffer);
+#ifdef AUI_VOTING_SCORE_CACHE
+	GET_PLAYER(eOtherPlayer).GetLeagueAI()->EndScoreCaching();
+	GetPlayer()->GetLeagueAI()->EndScoreCaching();
+#endif // AUI_VOTING_SCORE_CACHE
+	EndTradeItemValueCaching();
+	return bResult;
+}
+
+/// Does the actual work of DoEqualizeDealWithHuman() while trade item values are being remembered
+bool CvDealAI::DoEqualizeDealWithHumanInternal(CvDeal* pDeal, PlayerTypes eOtherPlayer, bool bDontChangeMyExistingItems, bool bDontChangeTheirExistingItems, bool& bDealGoodToBeginWith, bool& bCantMatchOffer)
+{
+#endif
 	bool bMakeOffer;
 	PlayerTypes eMyPlayer = GetPlayer()->GetID();
 	DEBUG_VARIABLE(eMyPlayer);
@@ -664,6 +729,26 @@ bool CvDealAI::DoEqualizeDealWithHuman(CvDeal* pDeal, PlayerTypes eOtherPlayer,
 /// Try to even out the value on both sides.  If bFavorMe is true we'll bias things in our favor if necessary
 bool CvDealAI::DoEqualizeDealWithAI(CvDeal* pDeal, PlayerTypes eOtherPlayer)
 {
+#ifdef AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE
+	BeginTradeItemValueCaching();
+#ifdef AUI_VOTING_SCORE_CACHE
+	// Vote commitment values ask both sides' league AI for their desires
+	GetPlayer()->GetLeagueAI()->BeginScoreCaching();
+	GET_PLAYER(eOtherPlayer).GetLeagueAI()->BeginScoreCaching();
+#endif // AUI_VOTING_SCORE_CACHE
+	bool bResult = DoEqualizeDealWithAIInternal(pDeal, eOtherPlayer);
+#ifdef AUI_VOTING_SCORE_CACHE
+	GET_PLAYER(eOtherPlayer).GetLeagueAI()->EndScoreCaching();
+	GetPlayer()->GetLeagueAI()->EndScoreCaching();
+#endif // AUI_VOTING_SCORE_CACHE
+	EndTradeItemValueCaching();
+	return bResult;
+}
+
+/// Does the actual work of DoEqualizeDealWithAI() while trade item values are being remembered
+bool CvDealAI::DoEqualizeDealWithAIInternal(CvDeal* pDeal, PlayerTypes eOtherPlayer)
+{
+#endif
 	PlayerTypes eMyPlayer = GetPlayer()->GetID();
 	DEBUG_VARIABLE(eMyPlayer);
 
@@ -835,6 +920,29 @@ int CvDealAI::GetTradeItemValue(TradeableItems eItem, bool bFromMe, PlayerTypes
 	CvAssertMsg(GetPlayer()->GetID() != eOtherPlayer, "DEAL_AI: Trying to get deal item value for trading to oneself.  Please send Jon this with your last 5 autosaves and what changelist # you're playing.");
 	CvAssertMsg(eItem != TRADE_ITEM_NONE, "DEAL_AI: Trying to get value of TRADE_ITEM_NONE.  Please send Jon this with your last 5 autosaves and what changelist # you're playing.");
 
+#ifdef AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE
+	TradeItemValueKey kKey;
+	TradeItemValueCache::const_iterator itCached = m_TradeItemValueCache.end();
+	if(m_iTradeItemValueCacheDepth > 0)
+	{
+		kKey.m_eItem = eItem;
+		kKey.m_eOtherPlayer = eOtherPlayer;
+		kKey.m_iData1 = iData1;
+		kKey.m_iData2 = iData2;
+		kKey.m_iData3 = iData3;
+		kKey.m_iDuration = iDuration;
+		kKey.m_bFromMe = bFromMe;
+		kKey.m_bFlag1 = bFlag1;
+		kKey.m_bUseEvenValue = bUseEvenValue;
+
+		itCached = m_TradeItemValueCache.find(kKey);
+#ifndef AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE_VALIDATE
+		if(itCached != m_TradeItemValueCache.end())
+			return (*itCached).second;
+#endif
+	}
+#endif // AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE
+
 	int iItemValue = 0;
 
 	if(eItem == TRADE_ITEM_GOLD)
@@ -866,6 +974,16 @@ int CvDealAI::GetTradeItemValue(TradeableItems eItem, bool bFromMe, PlayerTypes
 
 	CvAssertMsg(iItemValue >= 0, "DEAL_AI: Trade Item value is negative.  Please send Jon this with your last 5 autosaves and what changelist # you're playing.");
 
+#ifdef AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE
+	if(m_iTradeItemValueCacheDepth > 0)
+	{
+#ifdef AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE_VALIDATE
+		CvAssertMsg(itCached == m_TradeItemValueCache.end() || (*itCached).second == iItemValue, "DEAL_AI: Remembered trade item value differs from the recalculated one.");
+#endif
+		m_TradeItemValueCache[kKey] = iItemValue;
+	}
+#endif // AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE
+
 	return iItemValue;
 }
 
@@ -127,9 +127,38 @@ public:
 	void DoTradeScreenClosed(bool bAIWasMakingOffer);
 
 private:
+#ifdef AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE
+	bool DoEqualizeDealWithHumanInternal(CvDeal* pDeal, PlayerTypes eOtherPlayer, bool bDontChangeMyExistingItems, bool bDontChangeTheirExistingItems, bool& bDealGoodToBeginWith, bool& bCantMatchOffer);
+	bool DoEqualizeDealWithAIInternal(CvDeal* pDeal, PlayerTypes eOtherPlayer);
+
+	void BeginTradeItemValueCaching();
+	void EndTradeItemValueCaching();
+
+	/// Everything GetTradeItemValue() takes as input
+	struct TradeItemValueKey
+	{
+		TradeableItems m_eItem;
+		PlayerTypes m_eOtherPlayer;
+		int m_iData1;
+		int m_iData2;
+		int m_iData3;
+		int m_iDuration;
+		bool m_bFromMe;
+		bool m_bFlag1;
+		bool m_bUseEvenValue;
+
+		bool operator<(const TradeItemValueKey& rhs) const;
+	};
+	typedef std::map<TradeItemValueKey, int> TradeItemValueCache;
+#endif
+
 	CvPlayer* m_pPlayer;
 
 	int m_iCachedValueOfPeaceWithHuman;		// NOT SERIALIZED
+#ifdef AUI_DEAL_AI_TRADE_ITEM_VALUE_CACHE
+	TradeItemValueCache m_TradeItemValueCache;	// NOT SERIALIZED, only filled while a deal is being equalized
+	int m_iTradeItemValueCacheDepth;			// NOT SERIALIZED
+#endif
 
 };
 
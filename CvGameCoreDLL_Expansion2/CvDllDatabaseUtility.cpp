@@ -274,6 +274,11 @@ bool CvDllDatabaseUtility::PerformDatabasePostProcessing()
 bool CvDllDatabaseUtility::PrefetchGameData()
 {
 	cvStopWatch kTest("PrefetchGameData", "xml-perf.log");
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CACHE_MAX_ROWS
+
+	//Nothing writes to the database while prefetching, so row counts can be shared between collections.
+	CvDatabaseUtility::BeginMaxRowsCaching();
+#endif
 
 	//Because Colors and PlayerColors are used everywhere during load
 	//(by the translator) we load interface infos first.
@@ -397,6 +402,10 @@ bool CvDllDatabaseUtility::PrefetchGameData()
 		}
 	}
 
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CACHE_MAX_ROWS
+	CvDatabaseUtility::EndMaxRowsCaching();
+
+#endif
 	ValidatePrefetchProcess();
 
 	return true;
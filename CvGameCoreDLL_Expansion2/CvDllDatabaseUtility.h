@@ -115,6 +115,9 @@ bool CvDllDatabaseUtility::PrefetchCollection(std::vector<T*>& kCollection, cons
 	size_t index = 0;
 	Database::Results kResults;
 	CvDatabaseUtility kUtility;
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CACHE_MAX_ROWS
+	kCollection.reserve(kUtility.MaxRows(tableName));
+#endif
 
 	if(DB.SelectWhere(kResults, tableName, "ID > -1 ORDER BY ID"))
 	{
@@ -318,6 +318,13 @@ void CvEconomicAI::Reset()
 
 	m_bExplorationPlotsDirty = true;
 
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+	m_aiExplorePlotScores.clear();
+	m_aiStaleExplorePlots.clear();
+	m_aiExploreFrontier.clear();
+	m_aiGoodyHutCandidates.clear();
+#endif
+
 	for(uint ui = 0; ui < NUM_PURCHASE_TYPES; ui++)
 	{
 		CvPurchaseRequest request;
@@ -433,6 +440,14 @@ void CvEconomicAI::Read(FDataStream& kStream)
 	{
 		kStream >> m_RequestedSavings[i];
 	}
+
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+	// Plots are read without going through their setters, so the frontier has to be rebuilt from scratch
+	m_aiExplorePlotScores.clear();
+	m_aiStaleExplorePlots.clear();
+	m_aiExploreFrontier.clear();
+	m_aiGoodyHutCandidates.clear();
+#endif
 }
 
 /// Serialization write
@@ -2610,6 +2625,61 @@ void CvEconomicAI::UpdatePlots()
 	TeamTypes ePlayerTeam = m_pPlayer->getTeam();
 
 	CvPlot* pPlot;
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+	UpdateExploreFrontier();
+
+	// Goody huts and camps can still be blocked by units that move around, so only that part is checked every time
+	for(std::vector<int>::const_iterator it = m_aiGoodyHutCandidates.begin(); it != m_aiGoodyHutCandidates.end(); ++it)
+	{
+		pPlot = GC.getMap().plotByIndexUnchecked(*it);
+		if(pPlot->isRevealedGoody(ePlayerTeam) && !pPlot->isVisibleEnemyUnit(m_pPlayer->GetID()))
+		{
+			if(m_aiGoodyHutPlots.size() <= uiGoodyHutPlotIndex)
+			{
+				m_aiGoodyHutPlots.push_back(-1);
+				m_aiGoodyHutUnitAssignments.push_back(GoodyHutUnitAssignment(-1, -1));
+			}
+			m_aiGoodyHutPlots[uiGoodyHutPlotIndex] = *it;
+			m_aiGoodyHutUnitAssignments[uiGoodyHutPlotIndex].Clear();
+			++uiGoodyHutPlotIndex;
+		}
+		if(pPlot->HasBarbarianCamp() && pPlot->getNumDefenders(BARBARIAN_PLAYER) == 0)
+		{
+			if(m_aiGoodyHutPlots.size() <= uiGoodyHutPlotIndex)
+			{
+				m_aiGoodyHutPlots.push_back(-1);
+				m_aiGoodyHutUnitAssignments.push_back(GoodyHutUnitAssignment(-1, -1));
+			}
+			m_aiGoodyHutPlots[uiGoodyHutPlotIndex] = *it;
+			m_aiGoodyHutUnitAssignments[uiGoodyHutPlotIndex].Clear();
+			++uiGoodyHutPlotIndex;
+		}
+	}
+
+	for(std::vector<int>::const_iterator it = m_aiExploreFrontier.begin(); it != m_aiExploreFrontier.end(); ++it)
+	{
+		if(m_aiExplorationPlots.size() <= uiExplorationPlotIndex)
+		{
+			m_aiExplorationPlots.push_back(-1);
+			m_aiExplorationPlotRatings.push_back(-1);
+		}
+
+		m_aiExplorationPlots[uiExplorationPlotIndex] = *it;
+		m_aiExplorationPlotRatings[uiExplorationPlotIndex] = m_aiExplorePlotScores[*it];
+		uiExplorationPlotIndex++;
+	}
+
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER_VALIDATE
+	const uint uiIncrementalExplorationPlots = uiExplorationPlotIndex;
+	const uint uiIncrementalGoodyHutPlots = uiGoodyHutPlotIndex;
+	FFastVector<int> aiIncrementalExplorationPlots = m_aiExplorationPlots;
+	FFastVector<int> aiIncrementalExplorationPlotRatings = m_aiExplorationPlotRatings;
+	FFastVector<int> aiIncrementalGoodyHutPlots = m_aiGoodyHutPlots;
+	uiExplorationPlotIndex = 0;
+	uiGoodyHutPlotIndex = 0;
+#endif
+#endif // AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+#if !defined(AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER) || defined(AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER_VALIDATE)
 	for(int i = 0; i < GC.getMap().numPlots(); i++)
 	{
 		pPlot = GC.getMap().plotByIndexUnchecked(i);
@@ -2672,6 +2742,21 @@ void CvEconomicAI::UpdatePlots()
 		m_aiExplorationPlotRatings[uiExplorationPlotIndex] = iScore;
 		uiExplorationPlotIndex++;
 	}
+#endif
+
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER_VALIDATE
+	CvAssertMsg(uiIncrementalExplorationPlots == uiExplorationPlotIndex, "Incremental exploration frontier has a different number of plots than a full rescan");
+	CvAssertMsg(uiIncrementalGoodyHutPlots == uiGoodyHutPlotIndex, "Incremental goody hut list has a different number of plots than a full rescan");
+	for(uint ui = 0; ui < uiExplorationPlotIndex && ui < uiIncrementalExplorationPlots; ui++)
+	{
+		CvAssertMsg(aiIncrementalExplorationPlots[ui] == m_aiExplorationPlots[ui], "Incremental exploration frontier differs from a full rescan");
+		CvAssertMsg(aiIncrementalExplorationPlotRatings[ui] == m_aiExplorationPlotRatings[ui], "Incremental exploration plot rating differs from a full rescan");
+	}
+	for(uint ui = 0; ui < uiGoodyHutPlotIndex && ui < uiIncrementalGoodyHutPlots; ui++)
+	{
+		CvAssertMsg(aiIncrementalGoodyHutPlots[ui] == m_aiGoodyHutPlots[ui], "Incremental goody hut list differs from a full rescan");
+	}
+#endif
 
 	// assign explorers to goody huts
 
@@ -2717,6 +2802,103 @@ void CvEconomicAI::UpdatePlots()
 	m_bExplorationPlotsDirty = false;
 }
 
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+/// Inserts or removes iValue from a sorted vector
+static void SetSortedMembership(std::vector<int>& aiSorted, int iValue, bool bMember)
+{
+	std::vector<int>::iterator it = std::lower_bound(aiSorted.begin(), aiSorted.end(), iValue);
+	const bool bPresent = (it != aiSorted.end() && *it == iValue);
+	if(bMember && !bPresent)
+		aiSorted.insert(it, iValue);
+	else if(!bMember && bPresent)
+		aiSorted.erase(it);
+}
+
+/// Tells the exploration frontiers of every player on eTeam (all players if NO_TEAM) that pPlot, and optionally its neighbors, have to be rescored
+void CvEconomicAI::InvalidateExploreFrontier(const CvPlot* pPlot, TeamTypes eTeam, bool bIncludeNeighbors)
+{
+	if(pPlot == NULL)
+		return;
+
+	for(int iPlayerLoop = 0; iPlayerLoop < MAX_PLAYERS; iPlayerLoop++)
+	{
+		CvPlayer& kPlayer = GET_PLAYER((PlayerTypes)iPlayerLoop);
+		if(eTeam != NO_TEAM && kPlayer.getTeam() != eTeam)
+			continue;
+
+		CvEconomicAI* pEconomicAI = kPlayer.GetEconomicAI();
+		if(pEconomicAI == NULL || pEconomicAI->m_aiExplorePlotScores.empty())
+			continue;
+
+		pEconomicAI->MarkExplorePlotStale(GC.getMap().plotNum(pPlot->getX(), pPlot->getY()));
+		if(bIncludeNeighbors)
+		{
+			for(int iDirection = 0; iDirection < NUM_DIRECTION_TYPES; iDirection++)
+			{
+				CvPlot* pAdjacentPlot = plotDirection(pPlot->getX(), pPlot->getY(), (DirectionTypes)iDirection);
+				if(pAdjacentPlot != NULL)
+				{
+					pEconomicAI->MarkExplorePlotStale(GC.getMap().plotNum(pAdjacentPlot->getX(), pAdjacentPlot->getY()));
+				}
+			}
+		}
+	}
+}
+
+/// Queues a plot to be rescored on the next UpdatePlots()
+void CvEconomicAI::MarkExplorePlotStale(int iPlotIndex)
+{
+	if(iPlotIndex < 0 || iPlotIndex >= (int)m_aiExplorePlotScores.size() || m_aiExplorePlotScores[iPlotIndex] == -1)
+		return;
+
+	m_aiExplorePlotScores[iPlotIndex] = -1;
+	m_aiStaleExplorePlots.push_back(iPlotIndex);
+}
+
+/// Recalculates everything UpdatePlots() needs to know about a single plot
+void CvEconomicAI::RescoreExplorePlot(int iPlotIndex)
+{
+	CvPlot* pPlot = GC.getMap().plotByIndexUnchecked(iPlotIndex);
+	TeamTypes ePlayerTeam = m_pPlayer->getTeam();
+
+	int iScore = 0;
+	bool bGoodyHutCandidate = false;
+	if(pPlot->isRevealed(ePlayerTeam))
+	{
+		iScore = ScoreExplorePlot(pPlot, ePlayerTeam, 1, pPlot->isWater() ? DOMAIN_SEA : DOMAIN_LAND);
+		bGoodyHutCandidate = pPlot->isRevealedGoody(ePlayerTeam) || pPlot->HasBarbarianCamp();
+	}
+
+	m_aiExplorePlotScores[iPlotIndex] = iScore;
+	SetSortedMembership(m_aiExploreFrontier, iPlotIndex, iScore > 0);
+	SetSortedMembership(m_aiGoodyHutCandidates, iPlotIndex, bGoodyHutCandidate);
+}
+
+/// Rescores the plots that changed since the last call (all plots the first time)
+void CvEconomicAI::UpdateExploreFrontier()
+{
+	const int iNumPlots = GC.getMap().numPlots();
+	if((int)m_aiExplorePlotScores.size() != iNumPlots)
+	{
+		m_aiExplorePlotScores.assign(iNumPlots, -1);
+		m_aiStaleExplorePlots.clear();
+		m_aiExploreFrontier.clear();
+		m_aiGoodyHutCandidates.clear();
+		for(int iPlotLoop = 0; iPlotLoop < iNumPlots; iPlotLoop++)
+		{
+			RescoreExplorePlot(iPlotLoop);
+		}
+		return;
+	}
+
+	for(std::vector<int>::const_iterator it = m_aiStaleExplorePlots.begin(); it != m_aiStaleExplorePlots.end(); ++it)
+	{
+		RescoreExplorePlot(*it);
+	}
+	m_aiStaleExplorePlots.clear();
+}
+#endif // AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+
 #define PATH_PLAN_LAST
 typedef CvWeightedVector<CvUnit*, 50, true> WeightedUnitVector;
 //	---------------------------------------------------------------------------
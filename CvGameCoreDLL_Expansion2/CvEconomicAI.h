@@ -172,6 +172,9 @@ public:
 	void ClearUnitTargetGoodyStepPlot(CvUnit* pUnit);
 
 	static int ScoreExplorePlot(CvPlot* pPlot, TeamTypes eTeam, int iRange, DomainTypes eDomainType);
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+	static void InvalidateExploreFrontier(const CvPlot* pPlot, TeamTypes eTeam, bool bIncludeNeighbors);
+#endif
 
 	void StartSaveForPurchase(PurchaseType ePurchase, int iAmount, int iPriority);
 	bool IsSavingForThisPurchase(PurchaseType ePurchase);
@@ -238,6 +241,11 @@ private:
 	void DisbandExtraArchaeologists();
 
 	// Low-level utility functions
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+	void MarkExplorePlotStale(int iPlotIndex);
+	void RescoreExplorePlot(int iPlotIndex);
+	void UpdateExploreFrontier();
+#endif
 	void AssignExplorersToHuts();
 	void AssignHutsToExplorers();
 	CvUnit* FindWorkerToScrap();
@@ -282,6 +290,14 @@ private:
 	FStaticVector<CvPurchaseRequest, NUM_PURCHASE_TYPES, true, c_eCiv5GameplayDLL, 0> m_RequestedSavings;
 	FStaticVector<CvPurchaseRequest, NUM_PURCHASE_TYPES, true, c_eCiv5GameplayDLL, 0> m_TempRequestedSavings;
 	FFastVector<CvUnit*> m_apExplorers;
+
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+	// not serialized, rebuilt with a full scan on the first UpdatePlots() after a load
+	std::vector<int> m_aiExplorePlotScores;		// last ScoreExplorePlot() result for every plot (0 if unrevealed), -1 if it needs to be rescored
+	std::vector<int> m_aiStaleExplorePlots;		// plots whose score is -1
+	std::vector<int> m_aiExploreFrontier;		// sorted indices of plots with a positive score
+	std::vector<int> m_aiGoodyHutCandidates;	// sorted indices of revealed plots that hold a goody hut or a barbarian camp
+#endif
 };
 
 FDataStream& operator<<(FDataStream&, const CvPurchaseRequest&);
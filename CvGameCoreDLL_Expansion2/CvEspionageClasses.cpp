@@ -4199,6 +4199,14 @@ void CvEspionageAI::DoTurn()
 		}
 	}
 
+#ifdef AUI_ESPIONAGE_AI_LAZY_TARGET_LISTS
+	// spies only ever move if they are flagged for reassignment, so if none are, the lists below would be built for nothing
+	if (!HasSpyToReassign())
+	{
+		return;
+	}
+
+#endif // AUI_ESPIONAGE_AI_LAZY_TARGET_LISTS
 	int iTargetOffensiveSpies = 0;
 	int iTargetDefensiveSpies = 0;
 	int iTargetCityStateSpies = 0;
@@ -4435,6 +4443,52 @@ void CvEspionageAI::DoTurn()
 	}
 }
 
+#ifdef AUI_ESPIONAGE_AI_LAZY_TARGET_LISTS
+/// Is any living spy flagged to be moved or placed this turn?
+bool CvEspionageAI::HasSpyToReassign() const
+{
+	CvPlayerEspionage* pEspionage = m_pPlayer->GetEspionage();
+	for (uint uiSpy = 0; uiSpy < pEspionage->m_aSpyList.size(); uiSpy++)
+	{
+		const CvEspionageSpy& kSpy = pEspionage->m_aSpyList[uiSpy];
+		if (kSpy.m_eSpyState != SPY_STATE_DEAD && kSpy.m_bEvaluateReassignment)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/// The most expensive tech we can currently research (times 100), or -1 if there is none
+int CvEspionageAI::GetMaxResearchableTechCost() const
+{
+	int iMaxTechCost = -1;
+	CvPlayerTechs* pMyPlayerTechs = m_pPlayer->GetPlayerTechs();
+
+	for(int iTechLoop = 0; iTechLoop < GC.getNumTechInfos(); iTechLoop++)
+	{
+		const TechTypes eTech = static_cast<TechTypes>(iTechLoop);
+		CvTechEntry* pkTechInfo = GC.getTechInfo(eTech);
+		if(!pkTechInfo)
+		{
+			continue;
+		}
+
+		// try to find the most expensive tech that can be researched
+		if(pMyPlayerTechs->CanResearch(eTech))
+		{
+			int iTechCost = pMyPlayerTechs->GetResearchCost(eTech) * 100;
+			if(iTechCost > iMaxTechCost)
+			{
+				iMaxTechCost = iTechCost;
+			}
+		}
+	}
+
+	return iMaxTechCost;
+}
+#endif // AUI_ESPIONAGE_AI_LAZY_TARGET_LISTS
+
 /// Checks to see if there are any technologies to steal
 /// If so, steals them!
 void CvEspionageAI::StealTechnology()
@@ -4886,6 +4940,11 @@ void CvEspionageAI::BuildOffenseCityList(EspionageCityList& aOffenseCityList)
 	CvDiplomacyAI* pDiploAI = m_pPlayer->GetDiplomacyAI();
 
 	// find the most expensive available research
+#ifdef AUI_ESPIONAGE_AI_LAZY_TARGET_LISTS
+	// only looked up once a city actually needs it for its estimate
+	int iMaxTechCost = -1;
+	bool bMaxTechCostFound = false;
+#else
 	int iMaxTechCost = -1;
 	CvPlayerTechs* pMyPlayerTechs = m_pPlayer->GetPlayerTechs();
 
@@ -4908,6 +4967,7 @@ void CvEspionageAI::BuildOffenseCityList(EspionageCityList& aOffenseCityList)
 			}
 		}
 	}
+#endif // AUI_ESPIONAGE_AI_LAZY_TARGET_LISTS
 
 	std::vector<ScoreCityEntry> aCityScores;
 	CvCity* pLoopCity = NULL;
@@ -4954,6 +5014,13 @@ void CvEspionageAI::BuildOffenseCityList(EspionageCityList& aOffenseCityList)
 			// if we have any history with the city, use that data instead
 			else if(pCityEspionage->m_aiLastBasePotential[m_pPlayer->GetID()] > 0)
 			{
+#ifdef AUI_ESPIONAGE_AI_LAZY_TARGET_LISTS
+				if(!bMaxTechCostFound && pEspionage->m_aiMaxTechCost[eTargetPlayer] <= 0)
+				{
+					iMaxTechCost = GetMaxResearchableTechCost();
+					bMaxTechCostFound = true;
+				}
+#endif // AUI_ESPIONAGE_AI_LAZY_TARGET_LISTS
 				int iCost = iMaxTechCost;
 				if(pEspionage->m_aiMaxTechCost[eTargetPlayer] > 0)
 				{
@@ -4965,6 +5032,13 @@ void CvEspionageAI::BuildOffenseCityList(EspionageCityList& aOffenseCityList)
 			// estimate the number of turns using the population
 			else
 			{
+#ifdef AUI_ESPIONAGE_AI_LAZY_TARGET_LISTS
+				if(!bMaxTechCostFound && pEspionage->m_aiMaxTechCost[eTargetPlayer] <= 0)
+				{
+					iMaxTechCost = GetMaxResearchableTechCost();
+					bMaxTechCostFound = true;
+				}
+#endif // AUI_ESPIONAGE_AI_LAZY_TARGET_LISTS
 				int iCost = iMaxTechCost;
 				if(pEspionage->m_aiMaxTechCost[eTargetPlayer] > 0)
 				{
@@ -305,6 +305,10 @@ public:
 	void BuildOffenseCityList(EspionageCityList& aOffenseCityList);
 	void BuildDefenseCityList(EspionageCityList& aDefenseCityList);
 	void BuildMinorCityList(EspionageCityList& aMinorCityList);
+#ifdef AUI_ESPIONAGE_AI_LAZY_TARGET_LISTS
+	bool HasSpyToReassign() const;
+	int GetMaxResearchableTechCost() const;
+#endif // AUI_ESPIONAGE_AI_LAZY_TARGET_LISTS
 
 	int GetCityStatePlan(PlayerTypes* peThreatPlayer = NULL);
 
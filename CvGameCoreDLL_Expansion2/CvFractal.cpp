@@ -347,8 +347,35 @@ int CvFractal::getHeightFromPercent(int iPercent)
 	iPercent = range(iPercent, 0, 100);
 	iEstimate = 255 * iPercent / 100;
 
+#ifdef AUI_FRACTAL_HEIGHT_FROM_PERCENT_HISTOGRAM
+	// aiNumBelow[i] = number of heights below i; heights above 255 are never below an estimate
+	int aiNumBelow[256 + 1];
+	for(iX = 0; iX < 256 + 1; iX++)
+	{
+		aiNumBelow[iX] = 0;
+	}
+	for(iX = 0; iX < m_iFracX; iX++)
+	{
+		for(iY = 0; iY < m_iFracY; iY++)
+		{
+			int iHeight = m_aaiFrac[iX][iY];
+			if(iHeight < 256)
+			{
+				aiNumBelow[std::max(iHeight, -1) + 1]++;
+			}
+		}
+	}
+	for(iX = 1; iX < 256 + 1; iX++)
+	{
+		aiNumBelow[iX] += aiNumBelow[iX - 1];
+	}
+
+#endif
 	while(iEstimate != iLowerBound)
 	{
+#ifdef AUI_FRACTAL_HEIGHT_FROM_PERCENT_HISTOGRAM
+		iSum = aiNumBelow[iEstimate];
+#else
 		iSum = 0;
 
 		for(iX = 0; iX < m_iFracX; iX++)
@@ -361,6 +388,7 @@ int CvFractal::getHeightFromPercent(int iPercent)
 				}
 			}
 		}
+#endif
 		if(((100 * iSum) / (m_iFracX * m_iFracY)) > iPercent)
 		{
 			iUpperBound = iEstimate;
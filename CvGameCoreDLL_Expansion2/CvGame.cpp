@@ -998,6 +998,12 @@ void CvGame::uninit()
 	m_iNumVictoryVotesExpected = 0;
 	m_iVotesNeededForDiploVictory = 0;
 	m_iMapScoreMod = 0;
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+	invalidateRollingSyncChecksum();
+#endif
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+	m_iWorldWonderEpoch = 0;
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 	m_uiInitialTime = 0;
 
@@ -7332,6 +7338,21 @@ void CvGame::incrementBuildingClassCreatedCount(BuildingClassTypes eIndex)
 	m_paiBuildingClassCreatedCount[eIndex]++;
 }
 
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+//	--------------------------------------------------------------------------------
+/// Changes whenever a world wonder is added to or removed from any city (only differences between two reads are meaningful, value is not saved)
+int CvGame::GetWorldWonderEpoch() const
+{
+	return m_iWorldWonderEpoch;
+}
+
+//	--------------------------------------------------------------------------------
+void CvGame::BumpWorldWonderEpoch()
+{
+	m_iWorldWonderEpoch++;
+}
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+
 
 //	--------------------------------------------------------------------------------
 int CvGame::getProjectCreatedCount(ProjectTypes eIndex)
@@ -9083,10 +9104,12 @@ int CvGame::getAsyncRandNum(int iNum, const char* pszLog)
 //	--------------------------------------------------------------------------------
 int CvGame::calculateSyncChecksum()
 {
+#ifndef AUI_GAME_ROLLING_SYNC_CHECKSUM
 	CvUnit* pLoopUnit;
+	int iLoop;
+#endif
 	int iMultiplier;
 	int iValue;
-	int iLoop;
 	int iI, iJ;
 
 	iValue = 0;
@@ -9100,6 +9123,43 @@ int CvGame::calculateSyncChecksum()
 	iValue += GC.getMap().getOwnedPlots();
 	iValue += GC.getMap().getNumAreas();
 
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+	// Rolling checksum is rebuilt from scratch only after a reset or load, the synced setters keep it up to date otherwise
+	if(!m_bRollingSyncChecksumValid)
+	{
+		recalculateRollingSyncChecksum(m_auiRollingSyncChecksum);
+		m_bRollingSyncChecksumValid = true;
+	}
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM_VALIDATE
+	else
+	{
+		static const char* aszRollingSyncChecksumFields[NUM_ROLLING_SYNC_CHECKSUM_TYPES] = { "unit position/health/experience/level", "city population", "player gold" };
+		uint auiFullChecksum[NUM_ROLLING_SYNC_CHECKSUM_TYPES];
+		recalculateRollingSyncChecksum(auiFullChecksum);
+		for(iI = 0; iI < NUM_ROLLING_SYNC_CHECKSUM_TYPES; iI++)
+		{
+			if(auiFullChecksum[iI] != m_auiRollingSyncChecksum[iI])
+			{
+				CvString strMessage;
+				strMessage.Format("Turn %03d, slice %d: rolling sync checksum diverged from full recalculation on field %s (rolling %08X, full %08X)", getGameTurn(), getTurnSlice(), aszRollingSyncChecksumFields[iI], m_auiRollingSyncChecksum[iI], auiFullChecksum[iI]);
+				LOGFILEMGR.GetLog("SyncChecksum_Log.txt", FILogFile::kDontTimeStamp)->Msg(strMessage);
+				CvAssertMsg(false, strMessage);
+				// Resynchronize so that later divergences are reported as well
+				for(iJ = 0; iJ < NUM_ROLLING_SYNC_CHECKSUM_TYPES; iJ++)
+				{
+					m_auiRollingSyncChecksum[iJ] = auiFullChecksum[iJ];
+				}
+				break;
+			}
+		}
+	}
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM_VALIDATE
+	for(iI = 0; iI < NUM_ROLLING_SYNC_CHECKSUM_TYPES; iI++)
+	{
+		iValue += (int)m_auiRollingSyncChecksum[iI];
+	}
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
+
 	for(iI = 0; iI < MAX_PLAYERS; iI++)
 	{
 		if(GET_PLAYER((PlayerTypes)iI).isEverAlive())
@@ -9154,6 +9214,10 @@ int CvGame::calculateSyncChecksum()
 				break;
 
 			case 3:
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+				// Unit state is covered by the rolling checksum on every slice
+				iMultiplier += (GET_PLAYER((PlayerTypes)iI).getNumUnits() * 324111);
+#else
 				for(pLoopUnit = GET_PLAYER((PlayerTypes)iI).firstUnit(&iLoop); pLoopUnit != NULL; pLoopUnit = GET_PLAYER((PlayerTypes)iI).nextUnit(&iLoop))
 				{
 					iMultiplier += (pLoopUnit->getX() * 876543);
@@ -9162,6 +9226,7 @@ int CvGame::calculateSyncChecksum()
 					iMultiplier += (pLoopUnit->getExperience() * 820622);
 					iMultiplier += (pLoopUnit->getLevel() * 367291);
 				}
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
 				break;
 			}
 
@@ -9175,6 +9240,57 @@ int CvGame::calculateSyncChecksum()
 	return iValue;
 }
 
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+//	--------------------------------------------------------------------------------
+/// Called by synced setters: swaps an object's old contribution to the rolling checksum for its new one
+void CvGame::updateRollingSyncChecksum(RollingSyncChecksumTypes eType, uint uiOldContribution, uint uiNewContribution)
+{
+	// Contributions are combined with XOR, so they can be taken out again in any order
+	if(m_bRollingSyncChecksumValid)
+	{
+		m_auiRollingSyncChecksum[eType] ^= uiOldContribution ^ uiNewContribution;
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// Forces the next calculateSyncChecksum() to rebuild the rolling checksum (eg. after a load, when objects were read without going through their setters)
+void CvGame::invalidateRollingSyncChecksum()
+{
+	for(int iI = 0; iI < NUM_ROLLING_SYNC_CHECKSUM_TYPES; iI++)
+	{
+		m_auiRollingSyncChecksum[iI] = 0;
+	}
+	m_bRollingSyncChecksumValid = false;
+}
+
+//	--------------------------------------------------------------------------------
+/// Full recalculation of the rolling checksum
+void CvGame::recalculateRollingSyncChecksum(uint* pauiChecksums) const
+{
+	int iI, iLoop;
+	for(iI = 0; iI < NUM_ROLLING_SYNC_CHECKSUM_TYPES; iI++)
+	{
+		pauiChecksums[iI] = 0;
+	}
+
+	for(iI = 0; iI < MAX_PLAYERS; iI++)
+	{
+		CvPlayer& kPlayer = GET_PLAYER((PlayerTypes)iI);
+		for(const CvUnit* pLoopUnit = kPlayer.firstUnit(&iLoop); pLoopUnit != NULL; pLoopUnit = kPlayer.nextUnit(&iLoop))
+		{
+			pauiChecksums[ROLLING_SYNC_CHECKSUM_UNITS] ^= pLoopUnit->GetRollingSyncChecksum();
+		}
+		for(const CvCity* pLoopCity = kPlayer.firstCity(&iLoop); pLoopCity != NULL; pLoopCity = kPlayer.nextCity(&iLoop))
+		{
+			pauiChecksums[ROLLING_SYNC_CHECKSUM_CITIES] ^= pLoopCity->GetRollingSyncChecksum();
+		}
+		if(kPlayer.GetTreasury())
+		{
+			pauiChecksums[ROLLING_SYNC_CHECKSUM_GOLD] ^= kPlayer.GetTreasury()->GetRollingSyncChecksum();
+		}
+	}
+}
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
 
 //	--------------------------------------------------------------------------------
 int CvGame::calculateOptionsChecksum()
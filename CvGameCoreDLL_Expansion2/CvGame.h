@@ -48,6 +48,25 @@ public:
 	std::vector<bool> GrantInitialUnitsPerPlayer;
 };
 
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+enum RollingSyncChecksumTypes
+{
+	ROLLING_SYNC_CHECKSUM_UNITS,
+	ROLLING_SYNC_CHECKSUM_CITIES,
+	ROLLING_SYNC_CHECKSUM_GOLD,
+	NUM_ROLLING_SYNC_CHECKSUM_TYPES
+};
+
+#define ROLLING_SYNC_CHECKSUM_SEED (2166136261U)
+/// Folds a value into a rolling sync checksum contribution (FNV-1a step with an extra shift so small values spread out)
+inline uint RollingSyncChecksumMix(uint uiHash, int iValue)
+{
+	uiHash ^= (uint)iValue;
+	uiHash *= 16777619U;
+	return uiHash ^ (uiHash >> 15);
+}
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
+
 class CvGame
 {
 public:
@@ -396,6 +415,10 @@ public:
 	int getBuildingClassCreatedCount(BuildingClassTypes eIndex);
 	bool isBuildingClassMaxedOut(BuildingClassTypes eIndex, int iExtra = 0);
 	void incrementBuildingClassCreatedCount(BuildingClassTypes eIndex);
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+	int GetWorldWonderEpoch() const;
+	void BumpWorldWonderEpoch();
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 	int getProjectCreatedCount(ProjectTypes eIndex);
 	bool isProjectMaxedOut(ProjectTypes eIndex, int iExtra = 0);
@@ -435,6 +458,11 @@ public:
 
 	int calculateSyncChecksum();
 	int calculateOptionsChecksum();
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+	void updateRollingSyncChecksum(RollingSyncChecksumTypes eType, uint uiOldContribution, uint uiNewContribution);
+	void invalidateRollingSyncChecksum();
+	void recalculateRollingSyncChecksum(uint* pauiChecksums) const;
+#endif
 
 	void addReplayMessage(ReplayMessageTypes eType, PlayerTypes ePlayer, const CvString& pszText, int iPlotX = -1, int iPlotY = -1);
 	void clearReplayMessageMap();
@@ -619,6 +647,13 @@ protected:
 	int m_iNumVictoryVotesExpected;
 	int m_iVotesNeededForDiploVictory;
 	int m_iMapScoreMod;
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+	uint m_auiRollingSyncChecksum[NUM_ROLLING_SYNC_CHECKSUM_TYPES];
+	bool m_bRollingSyncChecksumValid;
+#endif
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+	int m_iWorldWonderEpoch; // not saved
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 	unsigned int m_uiInitialTime;
 
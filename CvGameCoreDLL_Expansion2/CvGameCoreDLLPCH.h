@@ -108,6 +108,7 @@ typedef wchar_t          wchar;
 #include "CvDefines.h"
 #include "CvGameCoreEnums.h"
 #include "CvStructs.h"
+#include "CvNodePoolAllocator.h"
 #include "ICvDLLUtility.h"
 #include "ICvDllUserInterface.h"
 #include "Lua/CvLuaSupport.h"
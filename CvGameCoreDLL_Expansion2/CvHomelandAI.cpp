@@ -862,7 +862,7 @@ void CvHomelandAI::PlotExplorerMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -891,7 +891,7 @@ void CvHomelandAI::PlotExplorerSeaMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -920,7 +920,7 @@ void CvHomelandAI::PlotFirstTurnSettlerMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		bool bGoingToSettle = false;
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
@@ -1001,7 +1001,7 @@ void CvHomelandAI::PlotHealMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit && !pUnit->isHuman())
@@ -1052,7 +1052,7 @@ void CvHomelandAI::PlotMovesToSafety()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -1217,7 +1217,7 @@ void CvHomelandAI::PlotWorkerMoves()
 #endif // AUI_HOMELAND_PLOT_WORKER_MOVES_EMPLOYS_AITYPE_FLIP
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -1253,7 +1253,7 @@ void CvHomelandAI::PlotWorkerSeaMoves()
 #endif // AUI_MILITARY_AITYPE_FLIP
 #endif // AUI_HOMELAND_PLOT_SEA_WORKER_MOVES_EMPLOYS_AITYPE_FLIP
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -1409,7 +1409,7 @@ void CvHomelandAI::PlotPatrolMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all remaining units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit && !pUnit->isHuman() && pUnit->getDomainType() != DOMAIN_AIR && !pUnit->isTrade())
@@ -1450,7 +1450,7 @@ void CvHomelandAI::PlotUpgradeMoves()
 	bool bMissingResource;
 
 	ClearCurrentMoveUnits();
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		// Don't try and upgrade a human player's unit or one already recruited for an operation
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
@@ -1723,7 +1723,7 @@ void CvHomelandAI::PlotWriterMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -1749,7 +1749,7 @@ void CvHomelandAI::PlotArtistMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -1775,7 +1775,7 @@ void CvHomelandAI::PlotMusicianMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -1801,7 +1801,7 @@ void CvHomelandAI::PlotScientistMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -1827,7 +1827,7 @@ void CvHomelandAI::PlotEngineerMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -1853,7 +1853,7 @@ void CvHomelandAI::PlotMerchantMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -1879,7 +1879,7 @@ void CvHomelandAI::PlotProphetMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -1905,7 +1905,7 @@ void CvHomelandAI::PlotMissionaryMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -1931,7 +1931,7 @@ void CvHomelandAI::PlotInquisitorMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -1957,7 +1957,7 @@ void CvHomelandAI::PlotSSPartMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -1983,7 +1983,7 @@ void CvHomelandAI::PlotSSPartAdds()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -2009,7 +2009,7 @@ void CvHomelandAI::PlotTreasureMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -2035,7 +2035,7 @@ void CvHomelandAI::PlotGeneralMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -2061,7 +2061,7 @@ void CvHomelandAI::PlotAdmiralMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -2087,7 +2087,7 @@ void CvHomelandAI::PlotAircraftMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -2116,7 +2116,7 @@ void CvHomelandAI::PlotTradeUnitMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -2142,7 +2142,7 @@ void CvHomelandAI::PlotArchaeologistMoves()
 	ClearCurrentMoveUnits();
 
 	// Loop through all recruited units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -2253,7 +2253,7 @@ void CvHomelandAI::PlotAirliftMoves()
 void CvHomelandAI::ReviewUnassignedUnits()
 {
 	// Loop through all remaining units
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
 		if(pUnit)
@@ -2834,6 +2834,11 @@ void CvHomelandAI::ExecuteWorkerMoves()
 {
 	CvString strLogString;
 
+#ifdef AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+	// Plot scores are shared between the workers moved in this pass only
+	m_pPlayer->GetBuilderTaskingAI()->BeginSharedPlotBuildScores();
+#endif // AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+
 	FStaticVector< CvHomelandUnit, 64, true, c_eCiv5GameplayDLL >::iterator it;
 	for(it = m_CurrentMoveUnits.begin(); it != m_CurrentMoveUnits.end(); ++it)
 	{
@@ -2963,6 +2968,10 @@ void CvHomelandAI::ExecuteWorkerMoves()
 			UnitProcessed(pUnit->GetID());
 		}
 	}
+
+#ifdef AUI_WORKER_SHARED_PLOT_BUILD_SCORES
+	m_pPlayer->GetBuilderTaskingAI()->EndSharedPlotBuildScores();
+#endif // AUI_WORKER_SHARED_PLOT_BUILD_SCORES
 }
 
 /// Send work boats to deploy on naval resources (return true if improvement built)
@@ -5666,7 +5675,7 @@ bool CvHomelandAI::FindWorkersInSameArea(CvPlot* pTarget, BuildTypes eBuild)
 	ClearCurrentMoveUnits();
 
 	// Loop through all units available to homeland AI this turn
-	for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+	for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 	{
 		UnitHandle pLoopUnit = m_pPlayer->getUnit(*it);
 		if(pLoopUnit)
@@ -5711,7 +5720,7 @@ bool CvHomelandAI::FindUnitsForThisMove(AIHomelandMove eMove, bool bFirstTime)
 		ClearCurrentMoveHighPriorityUnits();
 
 		// Loop through all units available to homeland AI this turn
-		for(list<int>::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
+		for(CvUnitIDList::iterator it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); ++it)
 		{
 			UnitHandle pLoopUnit = m_pPlayer->getUnit(*it);
 			if(pLoopUnit && !pLoopUnit->isHuman())
@@ -5828,7 +5837,7 @@ bool CvHomelandAI::FindUnitsForThisMove(AIHomelandMove eMove, bool bFirstTime)
 	{
 		FStaticVector< CvHomelandUnit, 64, true, c_eCiv5GameplayDLL > tempList;
 		FStaticVector< CvHomelandUnit, 64, true, c_eCiv5GameplayDLL >::iterator it;
-		std::list<int>::iterator it2;
+		CvUnitIDList::iterator it2;
 
 		// Normal priority units
 		tempList = m_CurrentMoveUnits;
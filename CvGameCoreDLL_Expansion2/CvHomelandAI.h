@@ -319,7 +319,7 @@ private:
 
 	// Class data
 	CvPlayer* m_pPlayer;
-	std::list<int> m_CurrentTurnUnits;
+	CvUnitIDList m_CurrentTurnUnits;
 
 	MoveUnitsArray m_CurrentMoveUnits;
 	MoveUnitsArray m_CurrentMoveHighPriorityUnits;
@@ -390,6 +390,9 @@ void CvMap::uninit()
 	m_iLandPlots = 0;
 	m_iOwnedPlots = 0;
 	m_iNumNaturalWonders = 0;
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+	m_iStepPathEpoch = 0;
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 
 	m_areas.Uninit();
 	m_landmasses.Uninit();
@@ -424,6 +427,9 @@ void CvMap::reset(CvMapInitData* pInitInfo)
 	m_iLandPlots = 0;
 	m_iOwnedPlots = 0;
 	m_iNumNaturalWonders = 0;
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+	m_iStepPathEpoch = 0;
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 
 	if(pInitInfo)
 	{
@@ -1615,6 +1621,21 @@ void CvMap::ChangeNumNaturalWonders(int iChange)
 	m_iNumNaturalWonders += iChange;
 }
 
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+//	--------------------------------------------------------------------------------
+/// Changes whenever something the step pathfinder looks at (plot ownership, areas, terrain, impassability, war, open borders, city-state friendship) changes; only differences between two reads are meaningful, value is not saved
+int CvMap::GetStepPathEpoch() const
+{
+	return m_iStepPathEpoch;
+}
+
+//	--------------------------------------------------------------------------------
+void CvMap::BumpStepPathEpoch()
+{
+	m_iStepPathEpoch++;
+}
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+
 //	--------------------------------------------------------------------------------
 /// Put Natural Wonders on the map - this could be a LUA script
 void CvMap::DoPlaceNaturalWonders()
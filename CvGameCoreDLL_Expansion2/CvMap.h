@@ -295,6 +295,11 @@ public:
 	int GetAIMapHint();
 	// End Natural Wonders stuff
 
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+	int GetStepPathEpoch() const;
+	void BumpStepPathEpoch();
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+
 	typedef FStaticVector<CvPlot*, 1000, true, c_eCiv5GameplayDLL, 1> DeferredPlotArray;
 	DeferredPlotArray m_vDeferredFogPlots; // don't serialize me
 
@@ -308,6 +313,9 @@ protected:
 	int m_iTopLatitude;
 	int m_iBottomLatitude;
 	int m_iNumNaturalWonders;
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+	int m_iStepPathEpoch; // not saved
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 
 	int m_iAIMapHints;	// currently only:
 						// 0 for normal, 
@@ -351,6 +351,10 @@ void CvMilitaryAI::Reset()
 		m_paeLastTurnMilitaryStrength[iI] = NO_STRENGTH_VALUE;
 		m_paeLastTurnTargetValue[iI] = NO_TARGET_VALUE;
 	}
+
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+	ResetAttackPathCaches();
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 }
 
 /// Serialization read
@@ -399,6 +403,10 @@ void CvMilitaryAI::Read(FDataStream& kStream)
 
 	ArrayWrapper<int> wrapm_paeLastTurnTargetValue(MAX_CIV_PLAYERS, m_paeLastTurnTargetValue);
 	kStream >> wrapm_paeLastTurnTargetValue;
+
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+	ResetAttackPathCaches();
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 }
 
 /// Serialization write
@@ -1088,7 +1096,11 @@ CvMilitaryTarget CvMilitaryAI::FindBestAttackTarget(AIOperationTypes eAIOperatio
 
 				else
 				{
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+					ShouldAttackBySeaCached(eEnemy, target);
+#else
 					ShouldAttackBySea(eEnemy, target);
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 
 					if (!pFriendlyCity->isCoastal() && target.m_bAttackBySea)
 					{
@@ -1163,12 +1175,19 @@ CvMilitaryTarget CvMilitaryAI::FindBestAttackTarget(AIOperationTypes eAIOperatio
 			{
 				continue;
 			}
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+			if (!DoesSeaPathExistCached(eEnemy, target))
+			{
+				continue;
+			}
+#else
 			CvPlot *pSeaPlotNearMuster = GetCoastalPlotAdjacentToTarget(target.m_pMusterCity->plot(), NULL);
 			CvPlot *pSeaPlotNearTarget = GetCoastalPlotAdjacentToTarget(target.m_pTargetCity->plot(), NULL);
 			if(!GC.getStepFinder().DoesPathExist(m_pPlayer->GetID(), eEnemy, pSeaPlotNearMuster, pSeaPlotNearTarget))
 			{
 				continue;
 			}
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 		}
 
 		iWeight = ScoreTarget(target, eAIOperationType);
@@ -1187,7 +1206,11 @@ CvMilitaryTarget CvMilitaryAI::FindBestAttackTarget(AIOperationTypes eAIOperatio
 		return chosenTarget;
 	}
 
+#ifdef AUI_WEIGHTED_VECTOR_PARTIAL_SORT_TOP_CHOICES
+	weightedTargetList.StableSortTopItems(max (1, (weightedTargetList.size() * 25 / 100)));
+#else
 	weightedTargetList.SortItems();
+#endif // AUI_WEIGHTED_VECTOR_PARTIAL_SORT_TOP_CHOICES
 	LogAttackTargets(eAIOperationType, eEnemy, weightedTargetList);
 
 	if(weightedTargetList.GetTotalWeight() > 0)
@@ -1278,6 +1301,103 @@ void CvMilitaryAI::ShouldAttackBySea(PlayerTypes eEnemy, CvMilitaryTarget& targe
 	target.m_iPathLength = iPathLength;
 }
 
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+/// Forgets every remembered path check
+void CvMilitaryAI::ResetAttackPathCaches()
+{
+	for(int iI = 0; iI < MAX_PLAYERS; iI++)
+	{
+		m_aAttackPathCaches[iI].m_Entries.clear();
+		m_aAttackPathCaches[iI].m_bValid = false;
+		m_aAttackPathCaches[iI].m_iStepPathEpoch = 0;
+		m_aAttackPathCaches[iI].m_bCanEmbark = false;
+		m_aAttackPathCaches[iI].m_bEmbarkedAllWaterPassage = false;
+	}
+}
+
+/// Remembered path checks between target's muster city and target city, emptied first if anything the step pathfinder looks at has changed since they were made
+CvMilitaryAI::AttackPathCacheEntry& CvMilitaryAI::GetAttackPathCacheEntry(PlayerTypes eEnemy, const CvMilitaryTarget& target)
+{
+	CvAssertMsg(eEnemy >= 0 && eEnemy < MAX_PLAYERS, "eEnemy is expected to be within maximum bounds (invalid Index)");
+	AttackPathCache& kCache = m_aAttackPathCaches[eEnemy];
+	CvTeam& kTeam = GET_TEAM(m_pPlayer->getTeam());
+	int iStepPathEpoch = GC.getMap().GetStepPathEpoch();
+	bool bCanEmbark = kTeam.canEmbark();
+	bool bEmbarkedAllWaterPassage = kTeam.getEmbarkedAllWaterPassage();
+
+	if(!kCache.m_bValid || kCache.m_iStepPathEpoch != iStepPathEpoch || kCache.m_bCanEmbark != bCanEmbark || kCache.m_bEmbarkedAllWaterPassage != bEmbarkedAllWaterPassage)
+	{
+		kCache.m_Entries.clear();
+		kCache.m_bValid = true;
+		kCache.m_iStepPathEpoch = iStepPathEpoch;
+		kCache.m_bCanEmbark = bCanEmbark;
+		kCache.m_bEmbarkedAllWaterPassage = bEmbarkedAllWaterPassage;
+	}
+
+	int iKey = target.m_pMusterCity->plot()->GetPlotIndex() * GC.getMap().numPlots() + target.m_pTargetCity->plot()->GetPlotIndex();
+	AttackPathCacheMap::iterator it = kCache.m_Entries.find(iKey);
+	if(it == kCache.m_Entries.end())
+	{
+		AttackPathCacheEntry kNewEntry;
+		kNewEntry.m_bLandChecked = false;
+		kNewEntry.m_bAttackBySea = false;
+		kNewEntry.m_iPathLength = 0;
+		kNewEntry.m_bSeaChecked = false;
+		kNewEntry.m_bSeaPathExists = false;
+		it = kCache.m_Entries.insert(std::make_pair(iKey, kNewEntry)).first;
+	}
+	return it->second;
+}
+
+/// Same as ShouldAttackBySea(), but reuses the result from the last time this pair of cities was checked
+void CvMilitaryAI::ShouldAttackBySeaCached(PlayerTypes eEnemy, CvMilitaryTarget& target)
+{
+	AttackPathCacheEntry& kEntry = GetAttackPathCacheEntry(eEnemy, target);
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE_VALIDATE
+	if(kEntry.m_bLandChecked)
+	{
+		CvMilitaryTarget kFresh = target;
+		ShouldAttackBySea(eEnemy, kFresh);
+		CvAssertMsg(kFresh.m_bAttackBySea == kEntry.m_bAttackBySea && kFresh.m_iPathLength == kEntry.m_iPathLength, "Remembered attack path is stale");
+	}
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE_VALIDATE
+	if(!kEntry.m_bLandChecked)
+	{
+		ShouldAttackBySea(eEnemy, target);
+		kEntry.m_bLandChecked = true;
+		kEntry.m_bAttackBySea = target.m_bAttackBySea;
+		kEntry.m_iPathLength = target.m_iPathLength;
+		return;
+	}
+
+	target.m_bAttackBySea = kEntry.m_bAttackBySea;
+	target.m_iPathLength = kEntry.m_iPathLength;
+}
+
+/// Is there a water path between the coasts next to target's muster city and target city?
+bool CvMilitaryAI::DoesSeaPathExist(PlayerTypes eEnemy, const CvMilitaryTarget& target) const
+{
+	CvPlot *pSeaPlotNearMuster = GetCoastalPlotAdjacentToTarget(target.m_pMusterCity->plot(), NULL);
+	CvPlot *pSeaPlotNearTarget = GetCoastalPlotAdjacentToTarget(target.m_pTargetCity->plot(), NULL);
+	return GC.getStepFinder().DoesPathExist(m_pPlayer->GetID(), eEnemy, pSeaPlotNearMuster, pSeaPlotNearTarget);
+}
+
+/// Same as DoesSeaPathExist(), but reuses the result from the last time this pair of cities was checked
+bool CvMilitaryAI::DoesSeaPathExistCached(PlayerTypes eEnemy, const CvMilitaryTarget& target)
+{
+	AttackPathCacheEntry& kEntry = GetAttackPathCacheEntry(eEnemy, target);
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE_VALIDATE
+	CvAssertMsg(!kEntry.m_bSeaChecked || kEntry.m_bSeaPathExists == DoesSeaPathExist(eEnemy, target), "Remembered sea path is stale");
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE_VALIDATE
+	if(!kEntry.m_bSeaChecked)
+	{
+		kEntry.m_bSeaPathExists = DoesSeaPathExist(eEnemy, target);
+		kEntry.m_bSeaChecked = true;
+	}
+	return kEntry.m_bSeaPathExists;
+}
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+
 /// Come up with a target priority looking at distance, strength, approaches (high score = more desirable target)
 int CvMilitaryAI::ScoreTarget(CvMilitaryTarget& target, AIOperationTypes eAIOperationType)
 {
@@ -307,6 +307,14 @@ private:
 	void RequestImprovements();
 	void DisbandObsoleteUnits();
 	bool IsAttackReady(MultiunitFormationTypes eFormation, AIOperationTypes eOperationType) const;
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+	struct AttackPathCacheEntry;
+	AttackPathCacheEntry& GetAttackPathCacheEntry(PlayerTypes eEnemy, const CvMilitaryTarget& target);
+	void ShouldAttackBySeaCached(PlayerTypes eEnemy, CvMilitaryTarget& target);
+	bool DoesSeaPathExistCached(PlayerTypes eEnemy, const CvMilitaryTarget& target);
+	bool DoesSeaPathExist(PlayerTypes eEnemy, const CvMilitaryTarget& target) const;
+	void ResetAttackPathCaches();
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 
 	// Logging functions
 	void LogStrategy(MilitaryAIStrategyTypes eStrategy, bool bValue);
@@ -357,6 +365,28 @@ private:
 	int m_iNumNavalAttacksRequested;
 	DefenseState m_eLandDefenseState;
 	DefenseState m_eNavalDefenseState;
+
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+	// Path checks between one of our cities and one of an enemy's cities (no need to serialize)
+	struct AttackPathCacheEntry
+	{
+		bool m_bLandChecked;
+		bool m_bAttackBySea;
+		int m_iPathLength;
+		bool m_bSeaChecked;
+		bool m_bSeaPathExists;
+	};
+	typedef stdext::hash_map<int, AttackPathCacheEntry> AttackPathCacheMap;
+	struct AttackPathCache
+	{
+		AttackPathCacheMap m_Entries;
+		bool m_bValid;
+		int m_iStepPathEpoch;
+		bool m_bCanEmbark;
+		bool m_bEmbarkedAllWaterPassage;
+	};
+	AttackPathCache m_aAttackPathCaches[MAX_PLAYERS];
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 };
 
 namespace MilitaryAIHelpers
@@ -34,6 +34,9 @@ CvMinorCivQuest::CvMinorCivQuest()
 	m_iData1 = NO_QUEST_DATA; /* -1 */
 	m_iData2 = NO_QUEST_DATA; /* -1 */
 	m_bHandled = false;
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+	ResetTestEpochs();
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 }
 
 // Constructor
@@ -46,12 +49,24 @@ CvMinorCivQuest::CvMinorCivQuest(PlayerTypes eMinor, PlayerTypes eAssignedPlayer
 	m_iData1 = NO_QUEST_DATA; /* -1 */
 	m_iData2 = NO_QUEST_DATA; /* -1 */
 	m_bHandled = false;
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+	ResetTestEpochs();
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 }
 
 CvMinorCivQuest::~CvMinorCivQuest()
 {
 }
 
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+/// Forgets the remembered negative results of IsComplete() and IsExpired()
+void CvMinorCivQuest::ResetTestEpochs()
+{
+	m_iNotCompleteEpoch = -1;
+	m_iNotExpiredEpoch = -1;
+}
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+
 // The minor that gave this quest
 PlayerTypes CvMinorCivQuest::GetMinor() const
 {
@@ -412,16 +427,42 @@ bool CvMinorCivQuest::IsComplete()
 	else if(m_eType == MINOR_CIV_QUEST_CONSTRUCT_WONDER)
 	{
 		BuildingTypes eWonder = (BuildingTypes) m_iData1;
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+		// Nobody gained or lost a world wonder since the last negative result
+		int iEpoch = GC.getGame().GetWorldWonderEpoch();
+#ifndef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS_VALIDATE
+		if(m_iNotCompleteEpoch == iEpoch)
+		{
+			return false;
+		}
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS_VALIDATE
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 		// Player built the Wonder?
 		if(pAssignedPlayer->countNumBuildings(eWonder) > 0)
 		{
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS_VALIDATE
+			CvAssertMsg(m_iNotCompleteEpoch != iEpoch, "Remembered wonder quest result is stale");
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS_VALIDATE
 			return true;
 		}
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+		m_iNotCompleteEpoch = iEpoch;
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 	}
 	else if(m_eType == MINOR_CIV_QUEST_GREAT_PERSON)
 	{
 		UnitTypes eUnit = (UnitTypes) m_iData1;
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+		// Units only ever appear through addUnit(), so no new unit means still no Great Person
+		int iEpoch = pAssignedPlayer->GetNewUnitEpoch();
+#ifndef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS_VALIDATE
+		if(m_iNotCompleteEpoch == iEpoch)
+		{
+			return false;
+		}
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS_VALIDATE
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 		// Player has the Great Person?
 		int iLoop;
@@ -429,9 +470,15 @@ bool CvMinorCivQuest::IsComplete()
 		{
 			if(pLoopUnit->getUnitType() == eUnit)
 			{
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS_VALIDATE
+				CvAssertMsg(m_iNotCompleteEpoch != iEpoch, "Remembered Great Person quest result is stale");
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS_VALIDATE
 				return true;
 			}
 		}
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+		m_iNotCompleteEpoch = iEpoch;
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 	}
 	else if(m_eType == MINOR_CIV_QUEST_KILL_CITY_STATE)
 	{
@@ -639,6 +686,15 @@ bool CvMinorCivQuest::IsExpired()
 		CvBuildingEntry* pkBuildingInfo = GC.getBuildingInfo(eWonder);
 		CvAssertMsg(pkBuildingInfo, "Building info not expected to be FALSE! Please send Anton your save file and version.");
 		if(!pkBuildingInfo) return false;
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+		int iEpoch = GC.getGame().GetWorldWonderEpoch();
+#ifndef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS_VALIDATE
+		if(m_iNotExpiredEpoch == iEpoch)
+		{
+			return false;
+		}
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS_VALIDATE
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 		for(int iPlayerLoop = 0; iPlayerLoop < MAX_CIV_PLAYERS; iPlayerLoop++)
 		{
@@ -650,10 +706,16 @@ bool CvMinorCivQuest::IsExpired()
 				// Someone built the wonder, and it wasn't us
 				if(m_eAssignedPlayer != eLoopPlayer && pLoopPlayer->countNumBuildings(eWonder) > 0)
 				{
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS_VALIDATE
+					CvAssertMsg(m_iNotExpiredEpoch != iEpoch, "Remembered wonder quest expiry is stale");
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS_VALIDATE
 					return true;
 				}
 			}
 		}
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+		m_iNotExpiredEpoch = iEpoch;
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 	}
 
 	// Spawn a Great Person
@@ -800,6 +862,9 @@ void CvMinorCivQuest::SetHandled(bool bValue)
 void CvMinorCivQuest::DoStartQuest(int iStartTurn)
 {
 	m_iStartTurn = iStartTurn;
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+	ResetTestEpochs();
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 	CvPlayer* pMinor = &GET_PLAYER(m_eMinor);
 	CvPlayer* pAssignedPlayer = &GET_PLAYER(m_eAssignedPlayer);
@@ -1131,6 +1196,9 @@ void CvMinorCivQuest::DoStartQuestUsingExistingData(CvMinorCivQuest* pExistingQu
 	CvAssertMsg(pAssignedPlayer != NULL, "pAssignedPlayer should not be NULL. Please send Anton your save file and version.");
 	CvAssertMsg(pExistingQuest != NULL, "pExistingQuest should not be NULL. Please send Anton your save file and version.");
 	if(pMinor == NULL || pAssignedPlayer == NULL || pExistingQuest == NULL) return;
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+	ResetTestEpochs();
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 	Localization::String strMessage;
 	Localization::String strSummary;
@@ -1574,6 +1642,9 @@ FDataStream& operator>>(FDataStream& loadFrom, CvMinorCivQuest& writeTo)
 	{
 		writeTo.m_bHandled = false;
 	}
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+	writeTo.ResetTestEpochs();
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 	return loadFrom;
 }
@@ -4822,6 +4893,13 @@ BuildingTypes CvMinorCivAI::GetBestWonderForQuest(PlayerTypes ePlayer)
 			for(pLoopCity = GET_PLAYER(eWorldPlayer).firstCity(&iCityLoop); pLoopCity != NULL; pLoopCity = GET_PLAYER(eWorldPlayer).nextCity(&iCityLoop))
 			{
 				iWonderProgress = pLoopCity->GetCityBuildings()->GetBuildingProduction(eBuilding);
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+				// No progress can't be past a positive threshold, so skip the production cost computation
+				if(iWonderProgress == 0 && iCompletionThreshold > 0)
+				{
+					continue;
+				}
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 				if(iWonderProgress * 100 / pLoopCity->getProductionNeeded(eBuilding) >= iCompletionThreshold)
 				{
@@ -5841,6 +5919,12 @@ int CvMinorCivAI::GetFriendshipNeededForNextLevel(PlayerTypes ePlayer)
 /// What happens when Friendship changes?
 void CvMinorCivAI::DoFriendshipChangeEffects(PlayerTypes ePlayer, int iOldFriendship, int iNewFriendship, bool bFromQuest, bool bIgnoreMinorDeath)
 {
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+	// Friends get open borders, which changes where their units may path through
+	if(IsFriendshipAboveFriendsThreshold(iOldFriendship) != IsFriendshipAboveFriendsThreshold(iNewFriendship))
+		GC.getMap().BumpStepPathEpoch();
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+
 	// Can't give out bonuses if we're dead!
 	if(!bIgnoreMinorDeath && !GetPlayer()->isAlive())
 		return;
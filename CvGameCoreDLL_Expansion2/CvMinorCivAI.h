@@ -131,6 +131,9 @@ public:
 	void DoStartQuestUsingExistingData(CvMinorCivQuest* pExistingQuest);
 	bool DoFinishQuest();
 	bool DoCancelQuest();
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+	void ResetTestEpochs();
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 	// Public data
 	PlayerTypes m_eMinor;
@@ -140,6 +143,13 @@ public:
 	int m_iData1;
 	int m_iData2;
 	bool m_bHandled;
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+
+private:
+	// not saved, epoch at which IsComplete() / IsExpired() last returned false (-1 if none)
+	int m_iNotCompleteEpoch;
+	int m_iNotExpiredEpoch;
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 };
 FDataStream& operator>>(FDataStream&, CvMinorCivQuest&);
 FDataStream& operator<<(FDataStream&, const CvMinorCivQuest&);
@@ -0,0 +1,122 @@
+// CvNodePoolAllocator.h
+#pragma once
+
+#ifndef CV_NODE_POOL_ALLOCATOR_H
+#define CV_NODE_POOL_ALLOCATOR_H
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//
+//  CLASS:      CvNodePool
+//
+//  DESC:       Free list of blocks of a single size.  Freed blocks are kept for the next
+//				allocation of the same size instead of going back to the heap, so containers
+//				that are emptied and refilled every turn stop hitting the allocator once
+//				they have reached their usual size.  Not thread safe.
+//
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+template<size_t uiBlockSize>
+class CvNodePool
+{
+public:
+	static void* Allocate()
+	{
+		FreeBlock*& pHead = GetHead();
+		if(pHead != NULL)
+		{
+			FreeBlock* pBlock = pHead;
+			pHead = pBlock->m_pNext;
+			return pBlock;
+		}
+		return ::operator new(uiBlockSize < sizeof(FreeBlock) ? sizeof(FreeBlock) : uiBlockSize);
+	}
+
+	static void Free(void* pMemory)
+	{
+		if(pMemory != NULL)
+		{
+			FreeBlock* pBlock = static_cast<FreeBlock*>(pMemory);
+			pBlock->m_pNext = GetHead();
+			GetHead() = pBlock;
+		}
+	}
+
+private:
+	struct FreeBlock
+	{
+		FreeBlock* m_pNext;
+	};
+
+	static FreeBlock*& GetHead()
+	{
+		static FreeBlock* s_pHead = NULL;
+		return s_pHead;
+	}
+};
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//
+//  CLASS:      CvNodePoolAllocator
+//
+//  DESC:       Stateless STL allocator that takes single-element allocations (eg. std::list
+//				nodes) from the CvNodePool of the element's size; array allocations go straight
+//				to the heap
+//
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+template<class T>
+class CvNodePoolAllocator
+{
+public:
+	typedef T value_type;
+	typedef T* pointer;
+	typedef const T* const_pointer;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+
+	template<class U> struct rebind
+	{
+		typedef CvNodePoolAllocator<U> other;
+	};
+
+	CvNodePoolAllocator() {}
+	CvNodePoolAllocator(const CvNodePoolAllocator<T>&) {}
+	template<class U> CvNodePoolAllocator(const CvNodePoolAllocator<U>&) {}
+	template<class U> CvNodePoolAllocator<T>& operator=(const CvNodePoolAllocator<U>&) { return *this; }
+
+	pointer address(reference value) const { return &value; }
+	const_pointer address(const_reference value) const { return &value; }
+
+	pointer allocate(size_type uiCount, const void* = NULL)
+	{
+		if(uiCount == 1)
+		{
+			return static_cast<pointer>(CvNodePool<sizeof(T)>::Allocate());
+		}
+		return static_cast<pointer>(::operator new(uiCount * sizeof(T)));
+	}
+
+	void deallocate(pointer pMemory, size_type uiCount)
+	{
+		if(uiCount == 1)
+		{
+			CvNodePool<sizeof(T)>::Free(pMemory);
+		}
+		else
+		{
+			::operator delete(pMemory);
+		}
+	}
+
+	void construct(pointer pMemory, const T& value) { new(static_cast<void*>(pMemory)) T(value); }
+	void destroy(pointer pMemory) { pMemory->~T(); }
+
+	size_type max_size() const { return size_type(-1) / sizeof(T); }
+};
+
+template<class T, class U>
+inline bool operator==(const CvNodePoolAllocator<T>&, const CvNodePoolAllocator<U>&) { return true; }
+template<class T, class U>
+inline bool operator!=(const CvNodePoolAllocator<T>&, const CvNodePoolAllocator<U>&) { return false; }
+
+#endif // CV_NODE_POOL_ALLOCATOR_H
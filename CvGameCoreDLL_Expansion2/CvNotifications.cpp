@@ -247,6 +247,9 @@ void CvNotifications::Init(PlayerTypes ePlayer)
 	}
 	m_iNotificationsBeginIndex = 0;
 	m_iNotificationsEndIndex = 0;
+#ifdef AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+	m_NumUndismissedByKey.clear();
+#endif // AUI_NOTIFICATIONS_REDUNDANCY_INDEX
 }
 
 /// Uninit
@@ -258,6 +261,9 @@ void CvNotifications::Uninit(void)
 
 	m_iNotificationsBeginIndex = -1;
 	m_iNotificationsEndIndex = -1;
+#ifdef AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+	m_NumUndismissedByKey.clear();
+#endif // AUI_NOTIFICATIONS_REDUNDANCY_INDEX
 }
 
 /// Serialization read
@@ -283,6 +289,10 @@ void CvNotifications::Read(FDataStream& kStream)
 				m_aNotifications[ui].m_eNotificationType = (NotificationTypes)V1_IndexToHash[iIndex];
 		}
 	}
+#ifdef AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+
+	RebuildRedundancyIndex();
+#endif // AUI_NOTIFICATIONS_REDUNDANCY_INDEX
 }
 
 /// Serialization write
@@ -435,6 +445,9 @@ int CvNotifications::Add(NotificationTypes eNotificationType, const char* strMes
 	}
 
 	m_aNotifications[m_iNotificationsEndIndex] = newNotification;
+#ifdef AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+	ChangeNumUndismissed(newNotification, 1);
+#endif // AUI_NOTIFICATIONS_REDUNDANCY_INDEX
 
 	if(GC.getGame().isFinalInitialized())
 	{
@@ -500,6 +513,12 @@ void CvNotifications::Dismiss(int iLookupIndex, bool bUserInvoked)
 	{
 		if(m_aNotifications[iIndex].m_iLookupIndex == iLookupIndex)
 		{
+#ifdef AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+			if(!m_aNotifications[iIndex].m_bDismissed)
+			{
+				ChangeNumUndismissed(m_aNotifications[iIndex], -1);
+			}
+#endif // AUI_NOTIFICATIONS_REDUNDANCY_INDEX
 			m_aNotifications[iIndex].m_bDismissed = true;
 			GC.GetEngineUserInterface()->RemoveNotification(m_aNotifications[iIndex].m_iLookupIndex, m_ePlayer);
 
@@ -1119,7 +1138,26 @@ void CvNotifications::Activate(Notification& notification)
 }
 
 //	---------------------------------------------------------------------------
+#ifdef AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+bool CvNotifications::IsNotificationRedundant(Notification& notification)
+{
+	if(!notification.m_bDismissed && IsRedundancyIndexed(notification))
+	{
+		bool bRedundant = (GetNumUndismissed(GetRedundancyKey(notification)) > 0);
+#ifdef AUI_NOTIFICATIONS_REDUNDANCY_INDEX_VALIDATE
+		CvAssertMsg(bRedundant == IsNotificationRedundantInternal(notification), "Notification redundancy index is out of sync with the notification ring");
+#endif // AUI_NOTIFICATIONS_REDUNDANCY_INDEX_VALIDATE
+		return bRedundant;
+	}
+
+	return IsNotificationRedundantInternal(notification);
+}
+
+//	---------------------------------------------------------------------------
+bool CvNotifications::IsNotificationRedundantInternal(Notification& notification)
+#else
 bool CvNotifications::IsNotificationRedundant(Notification& notification)
+#endif // AUI_NOTIFICATIONS_REDUNDANCY_INDEX
 {
 	switch(notification.m_eNotificationType)
 	{
@@ -1501,6 +1539,12 @@ bool CvNotifications::IsNotificationExpired(int iIndex)
 			return true;
 		}
 
+#ifdef AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+		if(GetNumUndismissed(GetRedundancyKey(NOTIFICATION_FREE_TECH, -1, -1, -1, -1)) > 0)
+		{
+			return true;
+		}
+#else
 		int iNotificationIndex = m_iNotificationsBeginIndex;
 		while(iNotificationIndex != m_iNotificationsEndIndex)
 		{
@@ -1518,6 +1562,7 @@ bool CvNotifications::IsNotificationExpired(int iIndex)
 				iNotificationIndex = 0;
 			}
 		}
+#endif // AUI_NOTIFICATIONS_REDUNDANCY_INDEX
 
 		//Expire this notification if there are no more techs that can be researched at this time.
 		return pkPlayerTechs->GetNumTechsCanBeResearched() == 0;
@@ -1940,6 +1985,150 @@ void CvNotifications::IncrementEndIndex()
 	}
 }
 
+#ifdef AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+//	---------------------------------------------------------------------------
+bool CvNotifications::RedundancyKey::operator<(const RedundancyKey& rhs) const
+{
+	if(m_iType != rhs.m_iType)
+		return m_iType < rhs.m_iType;
+	if(m_iX != rhs.m_iX)
+		return m_iX < rhs.m_iX;
+	if(m_iY != rhs.m_iY)
+		return m_iY < rhs.m_iY;
+	if(m_iGameDataIndex != rhs.m_iGameDataIndex)
+		return m_iGameDataIndex < rhs.m_iGameDataIndex;
+	return m_iExtraGameData < rhs.m_iExtraGameData;
+}
+
+//	---------------------------------------------------------------------------
+// static
+/// Only keeps the fields that IsNotificationRedundant() compares for this notification type
+CvNotifications::RedundancyKey CvNotifications::GetRedundancyKey(NotificationTypes eNotificationType, int iX, int iY, int iGameDataIndex, int iExtraGameData)
+{
+	RedundancyKey kKey;
+	kKey.m_iType = (int)eNotificationType;
+	kKey.m_iX = -1;
+	kKey.m_iY = -1;
+	kKey.m_iGameDataIndex = -1;
+	kKey.m_iExtraGameData = -1;
+
+	switch(eNotificationType)
+	{
+	case NOTIFICATION_PRODUCTION:
+		kKey.m_iX = iX;
+		kKey.m_iY = iY;
+		break;
+	case NOTIFICATION_UNIT_PROMOTION:
+		kKey.m_iExtraGameData = iExtraGameData;
+		break;
+	case NOTIFICATION_LEAGUE_PROJECT_COMPLETE:
+	case NOTIFICATION_LEAGUE_PROJECT_PROGRESS:
+		kKey.m_iGameDataIndex = iGameDataIndex;
+		kKey.m_iExtraGameData = iExtraGameData;
+		break;
+	default:
+		break;
+	}
+
+	return kKey;
+}
+
+//	---------------------------------------------------------------------------
+// static
+CvNotifications::RedundancyKey CvNotifications::GetRedundancyKey(const Notification& notification)
+{
+	return GetRedundancyKey(notification.m_eNotificationType, notification.m_iX, notification.m_iY, notification.m_iGameDataIndex, notification.m_iExtraGameData);
+}
+
+//	---------------------------------------------------------------------------
+/// Whether IsNotificationRedundant() for this notification only asks "is there an undismissed notification with the same key?"
+bool CvNotifications::IsRedundancyIndexed(const Notification& notification)
+{
+	switch(notification.m_eNotificationType)
+	{
+	case NOTIFICATION_TECH:
+		// Notifications waiting an extra turn are only made redundant by other notifications waiting an extra turn
+		return !(notification.m_bWaitExtraTurn && IsNotificationTypeEndOfTurnExpired(notification.m_eNotificationType));
+	case NOTIFICATION_FREE_TECH:
+	case NOTIFICATION_POLICY:
+	case NOTIFICATION_FREE_POLICY:
+	case NOTIFICATION_PRODUCTION:
+	case NOTIFICATION_ENEMY_IN_TERRITORY:
+	case NOTIFICATION_UNIT_PROMOTION:
+	case NOTIFICATION_FOUND_PANTHEON:
+	case NOTIFICATION_FOUND_RELIGION:
+	case NOTIFICATION_ENHANCE_RELIGION:
+	case NOTIFICATION_ADD_REFORMATION_BELIEF:
+	case NOTIFICATION_CHOOSE_ARCHAEOLOGY:
+	case NOTIFICATION_CHOOSE_IDEOLOGY:
+	case NOTIFICATION_LEAGUE_CALL_FOR_PROPOSALS:
+	case NOTIFICATION_LEAGUE_CALL_FOR_VOTES:
+	case NOTIFICATION_LEAGUE_VOTING_SOON:
+	case NOTIFICATION_LEAGUE_PROJECT_COMPLETE:
+	case NOTIFICATION_LEAGUE_PROJECT_PROGRESS:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//	---------------------------------------------------------------------------
+int CvNotifications::GetNumUndismissed(const RedundancyKey& kKey) const
+{
+	std::map<RedundancyKey, int>::const_iterator it = m_NumUndismissedByKey.find(kKey);
+	if(it != m_NumUndismissedByKey.end())
+	{
+		return it->second;
+	}
+	return 0;
+}
+
+//	---------------------------------------------------------------------------
+void CvNotifications::ChangeNumUndismissed(const Notification& notification, int iChange)
+{
+	RedundancyKey kKey = GetRedundancyKey(notification);
+	std::map<RedundancyKey, int>::iterator it = m_NumUndismissedByKey.find(kKey);
+	if(it == m_NumUndismissedByKey.end())
+	{
+		CvAssertMsg(iChange > 0, "Removing a notification that is not in the redundancy index");
+		if(iChange > 0)
+		{
+			m_NumUndismissedByKey[kKey] = iChange;
+		}
+	}
+	else
+	{
+		it->second += iChange;
+		CvAssertMsg(it->second >= 0, "Notification redundancy index count went negative");
+		if(it->second <= 0)
+		{
+			m_NumUndismissedByKey.erase(it);
+		}
+	}
+}
+
+//	---------------------------------------------------------------------------
+void CvNotifications::RebuildRedundancyIndex()
+{
+	m_NumUndismissedByKey.clear();
+
+	int iIndex = m_iNotificationsBeginIndex;
+	while(iIndex != m_iNotificationsEndIndex)
+	{
+		if(!m_aNotifications[iIndex].m_bDismissed)
+		{
+			ChangeNumUndismissed(m_aNotifications[iIndex], 1);
+		}
+
+		iIndex++;
+		if(iIndex >= (int)m_aNotifications.size())
+		{
+			iIndex = 0;
+		}
+	}
+}
+#endif // AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+
 //	---------------------------------------------------------------------------
 // static
 void CvNotifications::AddToPlayer(PlayerTypes ePlayer, NotificationTypes eNotificationType, const char* strMessage, const char* strSummary, int iX/*=-1*/, int iY/*=-1*/, int iGameDataIndex/*=-1*/, int iExtraGameData/*=-1*/)
@@ -80,6 +80,9 @@ public:
 	void Activate(Notification& notification);
 
 	bool IsNotificationRedundant(Notification& notification);  // if there is already a message in the queue similiar to this one
+#ifdef AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+	bool IsNotificationRedundantInternal(Notification& notification);  // ring scan, used for the tests the redundancy index can't answer
+#endif // AUI_NOTIFICATIONS_REDUNDANCY_INDEX
 
 	bool IsNotificationExpired(int iIndex);
 	bool IsNotificationEndOfTurnExpired(int iIndex);  // remove it from the end of the turn
@@ -94,6 +97,26 @@ protected:
 	void IncrementBeginIndex();
 	void IncrementEndIndex();
 
+#ifdef AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+	struct RedundancyKey
+	{
+		bool operator<(const RedundancyKey& rhs) const;
+
+		int m_iType;
+		int m_iX;
+		int m_iY;
+		int m_iGameDataIndex;
+		int m_iExtraGameData;
+	};
+
+	static RedundancyKey GetRedundancyKey(NotificationTypes eNotificationType, int iX, int iY, int iGameDataIndex, int iExtraGameData);
+	static RedundancyKey GetRedundancyKey(const Notification& notification);
+	bool IsRedundancyIndexed(const Notification& notification);
+	int GetNumUndismissed(const RedundancyKey& kKey) const;
+	void ChangeNumUndismissed(const Notification& notification, int iChange);
+	void RebuildRedundancyIndex();
+#endif // AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+
 	PlayerTypes m_ePlayer;
 
 	std::vector<Notification> m_aNotifications;
@@ -101,6 +124,10 @@ protected:
 	int m_iNotificationsEndIndex;
 
 	int m_iCurrentLookupIndex;
+
+#ifdef AUI_NOTIFICATIONS_REDUNDANCY_INDEX
+	std::map<RedundancyKey, int> m_NumUndismissedByKey; // not saved, rebuilt from the ring on load
+#endif // AUI_NOTIFICATIONS_REDUNDANCY_INDEX
 };
 
 FDataStream& operator>>(FDataStream&, CvNotifications::Notification&);
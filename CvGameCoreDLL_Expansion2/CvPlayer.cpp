@@ -61,8 +61,19 @@
 // CvPlayer Version History
 // Version 1 
 //	 * CvPlayer save version reset for expansion pack 2.
+// Version 17
+//	 * Replay datasets are saved as delta-encoded columns (AUI_PLAYER_COLUMNAR_REPLAY_DATA).
 //------------------------------------------------------------------------------
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+const int g_CurrentCvPlayerVersion = 17;
+
+// Marks a turn inside a replay data column that has no value
+#define REPLAY_DATA_NO_VALUE ((int)MIN_INT)
+// A replay data column will not grow to span more turns than this (guards against garbage turns passed in from Lua)
+#define REPLAY_DATA_MAX_TURN_SPAN (0x10000)
+#else
 const int g_CurrentCvPlayerVersion = 16;
+#endif
 
 //Simply empty check utility.
 bool isEmpty(const char* szString)
@@ -882,6 +893,12 @@ void CvPlayer::uninit()
 	m_iCultureBombTimer = 0;
 	m_iConversionTimer = 0;
 	m_iCapitalCityID = FFreeList::INVALID_INDEX;
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	m_iBuildableEpoch = 0;
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+	m_iNewUnitEpoch = 0;
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 	m_iCitiesLost = 0;
 	m_iMilitaryMight = 0;
 	m_iEconomicMight = 0;
@@ -1197,6 +1214,9 @@ void CvPlayer::reset(PlayerTypes eID, bool bConstructorCall)
 	m_cities.RemoveAll();
 
 	m_units.RemoveAll();
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	RebuildUnitCounters();
+#endif // AUI_PLAYER_UNIT_COUNTERS
 
 	m_armyAIs.RemoveAll();
 
@@ -3637,6 +3657,31 @@ void CvPlayer::ChangeMaxNumBuilders(int iChange)
 /// Returns number of Units a player has with a particular UnitAI.  The second argument allows you to check whether or not to include Units currently being trained in Cities.
 int CvPlayer::GetNumUnitsWithUnitAI(UnitAITypes eUnitAIType, bool bIncludeBeingTrained, bool bIncludeWater)
 {
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	CvAssertMsg(eUnitAIType >= 0 && eUnitAIType < NUM_UNITAI_TYPES, "eUnitAIType is expected to be within maximum bounds (invalid Index)");
+	if(eUnitAIType < 0 || eUnitAIType >= NUM_UNITAI_TYPES)
+	{
+		return 0;
+	}
+
+	int iCountedUnits = m_aaiNumUnitsWithUnitAI[eUnitAIType][0];
+	if(bIncludeWater)
+	{
+		iCountedUnits += m_aaiNumUnitsWithUnitAI[eUnitAIType][1];
+	}
+	if(bIncludeBeingTrained)
+	{
+		iCountedUnits += m_aaiNumUnitsBeingTrainedWithUnitAI[eUnitAIType][0];
+		if(bIncludeWater)
+		{
+			iCountedUnits += m_aaiNumUnitsBeingTrainedWithUnitAI[eUnitAIType][1];
+		}
+	}
+#ifndef AUI_PLAYER_UNIT_COUNTERS_VALIDATE
+	return iCountedUnits;
+#endif
+#endif // AUI_PLAYER_UNIT_COUNTERS
+#if !defined(AUI_PLAYER_UNIT_COUNTERS) || defined(AUI_PLAYER_UNIT_COUNTERS_VALIDATE)
 	int iNumUnits = 0;
 
 	CvUnit* pLoopUnit;
@@ -3683,13 +3728,34 @@ int CvPlayer::GetNumUnitsWithUnitAI(UnitAITypes eUnitAIType, bool bIncludeBeingT
 		}
 	}
 
+#ifdef AUI_PLAYER_UNIT_COUNTERS_VALIDATE
+	CvAssertMsg(iNumUnits == iCountedUnits, "UnitAI counter does not match a scan of the player's units");
+#endif
 	return iNumUnits;
+#endif
 }
 
 //	--------------------------------------------------------------------------------
 /// Returns number of Units a player has of a particular domain.  The second argument allows you to check whether or not to include civilians.
 int CvPlayer::GetNumUnitsWithDomain(DomainTypes eDomain, bool bMilitaryOnly)
 {
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	CvAssertMsg(eDomain >= 0 && eDomain < NUM_DOMAIN_TYPES, "eDomain is expected to be within maximum bounds (invalid Index)");
+	if(eDomain < 0 || eDomain >= NUM_DOMAIN_TYPES)
+	{
+		return 0;
+	}
+
+	int iCountedUnits = m_aaiNumUnitsWithDomain[eDomain][1];
+	if(!bMilitaryOnly)
+	{
+		iCountedUnits += m_aaiNumUnitsWithDomain[eDomain][0];
+	}
+#ifndef AUI_PLAYER_UNIT_COUNTERS_VALIDATE
+	return iCountedUnits;
+#endif
+#endif // AUI_PLAYER_UNIT_COUNTERS
+#if !defined(AUI_PLAYER_UNIT_COUNTERS) || defined(AUI_PLAYER_UNIT_COUNTERS_VALIDATE)
 	int iNumUnits = 0;
 
 	CvUnit* pLoopUnit;
@@ -3707,12 +3773,27 @@ int CvPlayer::GetNumUnitsWithDomain(DomainTypes eDomain, bool bMilitaryOnly)
 		}
 	}
 
+#ifdef AUI_PLAYER_UNIT_COUNTERS_VALIDATE
+	CvAssertMsg(iNumUnits == iCountedUnits, "Domain counter does not match a scan of the player's units");
+#endif
 	return iNumUnits;
+#endif
 }
 
 //	-----------------------------------------------------------------------------------------------
 int CvPlayer::GetNumUnitsWithUnitCombat(UnitCombatTypes eUnitCombat)
 {
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	int iCountedUnits = 0;
+	if(eUnitCombat >= 0 && eUnitCombat < (int)m_aiNumUnitsWithUnitCombat.size())
+	{
+		iCountedUnits = m_aiNumUnitsWithUnitCombat[eUnitCombat];
+	}
+#ifndef AUI_PLAYER_UNIT_COUNTERS_VALIDATE
+	return iCountedUnits;
+#endif
+#endif // AUI_PLAYER_UNIT_COUNTERS
+#if !defined(AUI_PLAYER_UNIT_COUNTERS) || defined(AUI_PLAYER_UNIT_COUNTERS_VALIDATE)
 	int iNumUnits = 0;
 
 	CvUnit* pLoopUnit;
@@ -3727,8 +3808,80 @@ int CvPlayer::GetNumUnitsWithUnitCombat(UnitCombatTypes eUnitCombat)
 		}
 	}
 
+#ifdef AUI_PLAYER_UNIT_COUNTERS_VALIDATE
+	CvAssertMsg(iNumUnits == iCountedUnits, "UnitCombat counter does not match a scan of the player's units");
+#endif
 	return iNumUnits;
+#endif
+}
+
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+//	-----------------------------------------------------------------------------------------------
+/// Adds (iChange > 0) or removes (iChange < 0) one unit's contribution to the unit counters; called by CvUnit whenever anything that is counted changes
+void CvPlayer::ChangeUnitCounters(UnitAITypes eUnitAIType, bool bWater, DomainTypes eDomain, bool bCombat, UnitCombatTypes eUnitCombat, int iChange)
+{
+	if(eUnitAIType >= 0 && eUnitAIType < NUM_UNITAI_TYPES)
+	{
+		m_aaiNumUnitsWithUnitAI[eUnitAIType][bWater ? 1 : 0] += iChange;
+		CvAssertMsg(m_aaiNumUnitsWithUnitAI[eUnitAIType][bWater ? 1 : 0] >= 0, "UnitAI counter went negative");
+	}
+
+	if(eDomain >= 0 && eDomain < NUM_DOMAIN_TYPES)
+	{
+		m_aaiNumUnitsWithDomain[eDomain][bCombat ? 1 : 0] += iChange;
+		CvAssertMsg(m_aaiNumUnitsWithDomain[eDomain][bCombat ? 1 : 0] >= 0, "Domain counter went negative");
+	}
+
+	if(eUnitCombat >= 0 && eUnitCombat < (int)m_aiNumUnitsWithUnitCombat.size())
+	{
+		m_aiNumUnitsWithUnitCombat[eUnitCombat] += iChange;
+		CvAssertMsg(m_aiNumUnitsWithUnitCombat[eUnitCombat] >= 0, "UnitCombat counter went negative");
+	}
+}
+
+//	-----------------------------------------------------------------------------------------------
+/// A city started (iChange > 0) or stopped (iChange < 0) having eUnit at the head of its production queue
+void CvPlayer::ChangeNumUnitsBeingTrained(UnitTypes eUnit, int iChange)
+{
+	CvUnitEntry* pkUnitEntry = GC.getUnitInfo(eUnit);
+	if(pkUnitEntry)
+	{
+		UnitAITypes eUnitAIType = (UnitAITypes)pkUnitEntry->GetDefaultUnitAIType();
+		if(eUnitAIType >= 0 && eUnitAIType < NUM_UNITAI_TYPES)
+		{
+			int iWater = (pkUnitEntry->GetDomainType() == DOMAIN_SEA ? 1 : 0);
+			m_aaiNumUnitsBeingTrainedWithUnitAI[eUnitAIType][iWater] += iChange;
+			CvAssertMsg(m_aaiNumUnitsBeingTrainedWithUnitAI[eUnitAIType][iWater] >= 0, "Units being trained counter went negative");
+		}
+	}
+}
+
+//	-----------------------------------------------------------------------------------------------
+/// Recounts all unit counters from scratch (after loading or resetting the player)
+void CvPlayer::RebuildUnitCounters()
+{
+	for(int iI = 0; iI < NUM_UNITAI_TYPES; iI++)
+	{
+		m_aaiNumUnitsWithUnitAI[iI][0] = m_aaiNumUnitsWithUnitAI[iI][1] = 0;
+		m_aaiNumUnitsBeingTrainedWithUnitAI[iI][0] = m_aaiNumUnitsBeingTrainedWithUnitAI[iI][1] = 0;
+	}
+	for(int iI = 0; iI < NUM_DOMAIN_TYPES; iI++)
+	{
+		m_aaiNumUnitsWithDomain[iI][0] = m_aaiNumUnitsWithDomain[iI][1] = 0;
+	}
+	m_aiNumUnitsWithUnitCombat.assign(GC.getNumUnitCombatClassInfos(), 0);
+
+	int iLoop;
+	for(CvUnit* pLoopUnit = firstUnit(&iLoop); pLoopUnit != NULL; pLoopUnit = nextUnit(&iLoop))
+	{
+		pLoopUnit->UpdateOwnerUnitCounters(false, true);
+	}
+	for(CvCity* pLoopCity = firstCity(&iLoop); pLoopCity != NULL; pLoopCity = nextCity(&iLoop))
+	{
+		pLoopCity->UpdateOwnerProductionUnitCounters(false, true);
+	}
 }
+#endif // AUI_PLAYER_UNIT_COUNTERS
 
 //	-----------------------------------------------------------------------------------------------
 /// Setting up danger plots
@@ -9863,6 +10016,9 @@ int CvPlayer::GetCultureYieldFromPreviousTurns(int iGameTurn, int iNumPreviousTu
 {
 	// Culture per turn yield is tracked in replay data, so use that
 	int iSum = 0;
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+	const unsigned int uiCultureDataSet = getReplayDataSetIndex("REPLAYDATASET_CULTUREPERTURN");
+#endif
 	for (int iI = 0; iI < iNumPreviousTurnsToCount; iI++)
 	{
 		int iTurn = iGameTurn - iI;
@@ -9871,7 +10027,11 @@ int CvPlayer::GetCultureYieldFromPreviousTurns(int iGameTurn, int iNumPreviousTu
 			break;
 		}
 
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+		int iTurnCulture = getReplayDataValue(uiCultureDataSet, iTurn);
+#else
 		int iTurnCulture = getReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_CULTUREPERTURN"), iTurn);
+#endif
 		if (iTurnCulture >= 0)
 		{
 			iSum += iTurnCulture;
@@ -16926,6 +17086,9 @@ int CvPlayer::GetScienceYieldFromPreviousTurns(int iGameTurn, int iNumPreviousTu
 {
 	// Beakers per turn yield is tracked in replay data, so use that
 	int iSum = 0;
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+	const unsigned int uiScienceDataSet = getReplayDataSetIndex("REPLAYDATASET_SCIENCEPERTURN");
+#endif
 	for (int iI = 0; iI < iNumPreviousTurnsToCount; iI++)
 	{
 		int iTurn = iGameTurn - iI;
@@ -16934,7 +17097,11 @@ int CvPlayer::GetScienceYieldFromPreviousTurns(int iGameTurn, int iNumPreviousTu
 			break;
 		}
 
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+		int iTurnScience = getReplayDataValue(uiScienceDataSet, iTurn);
+#else
 		int iTurnScience = getReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_SCIENCEPERTURN"), iTurn);
+#endif
 		if (iTurnScience >= 0)
 		{
 			iSum += iTurnScience;
@@ -19227,9 +19394,31 @@ CvCity* CvPlayer::addCity()
 //	--------------------------------------------------------------------------------
 void CvPlayer::deleteCity(int iID)
 {
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	CvCity* pCity = m_cities.GetAt(iID);
+	if(pCity)
+	{
+		pCity->UpdateOwnerProductionUnitCounters(true);
+	}
+#endif // AUI_PLAYER_UNIT_COUNTERS
 	m_cities.RemoveAt(iID);
 }
 
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+//	--------------------------------------------------------------------------------
+/// Changes whenever a policy is adopted or a policy branch is unlocked or finished (only differences between two reads are meaningful, value is not saved)
+int CvPlayer::GetBuildableEpoch() const
+{
+	return m_iBuildableEpoch;
+}
+
+//	--------------------------------------------------------------------------------
+void CvPlayer::BumpBuildableEpoch()
+{
+	m_iBuildableEpoch++;
+}
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+
 //	--------------------------------------------------------------------------------
 CvCity* CvPlayer::GetFirstCityWithBuildingClass(BuildingClassTypes eBuildingClass)
 {
@@ -19296,13 +19485,32 @@ CvUnit* CvPlayer::getUnit(int iID)
 //	--------------------------------------------------------------------------------
 CvUnit* CvPlayer::addUnit()
 {
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+	m_iNewUnitEpoch++;
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 	return (m_units.Add());
 }
 
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+//	--------------------------------------------------------------------------------
+/// Changes whenever a unit is added to this player, including captured, gifted and converted units (only differences between two reads are meaningful, value is not saved)
+int CvPlayer::GetNewUnitEpoch() const
+{
+	return m_iNewUnitEpoch;
+}
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+
 
 //	--------------------------------------------------------------------------------
 void CvPlayer::deleteUnit(int iID)
 {
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	CvUnit* pUnit = m_units.GetAt(iID);
+	if(pUnit)
+	{
+		pUnit->UpdateOwnerUnitCounters(true);
+	}
+#endif // AUI_PLAYER_UNIT_COUNTERS
 	m_units.RemoveAt(iID);
 }
 
@@ -19582,6 +19790,18 @@ const char* CvPlayer::getReplayDataSetName(unsigned int idx) const
 //	--------------------------------------------------------------------------------
 unsigned int CvPlayer::getReplayDataSetIndex(const char* szDataSetName)
 {
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+	std::string strDataSetName(szDataSetName);
+	ReplayDataSetIndexMap::const_iterator it = m_ReplayDataSetIndexes.find(strDataSetName);
+	if(it != m_ReplayDataSetIndexes.end())
+		return (*it).second;
+
+	m_ReplayDataSets.push_back(szDataSetName);
+	m_ReplayDataSetValues.push_back(ReplayDataColumn());
+	const unsigned int idx = m_ReplayDataSets.size() - 1;
+	m_ReplayDataSetIndexes[strDataSetName] = idx;
+	return idx;
+#else
 	CvString dataSetName = szDataSetName;
 
 	unsigned int idx = 0;
@@ -19596,6 +19816,7 @@ unsigned int CvPlayer::getReplayDataSetIndex(const char* szDataSetName)
 	m_ReplayDataSets.push_back(dataSetName);
 	m_ReplayDataSetValues.push_back(TurnData());
 	return m_ReplayDataSets.size() - 1;
+#endif
 }
 
 //	--------------------------------------------------------------------------------
@@ -19603,12 +19824,18 @@ int CvPlayer::getReplayDataValue(unsigned int uiDataSet, unsigned int uiTurn) co
 {
 	if(uiDataSet < m_ReplayDataSetValues.size())
 	{
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+		int iValue;
+		if(m_ReplayDataSetValues[uiDataSet].GetValue(uiTurn, iValue))
+			return iValue;
+#else
 		const TurnData& dataSet = m_ReplayDataSetValues[uiDataSet];
 		TurnData::const_iterator it = dataSet.find(uiTurn);
 		if(it != dataSet.end())
 		{
 			return (*it).second;
 		}
+#endif
 	}
 
 	return -1;
@@ -19618,8 +19845,12 @@ void CvPlayer::setReplayDataValue(unsigned int uiDataSet, unsigned int uiTurn, i
 {
 	if(uiDataSet < m_ReplayDataSetValues.size())
 	{
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+		m_ReplayDataSetValues[uiDataSet].SetValue(uiTurn, iValue);
+#else
 		TurnData& dataSet = m_ReplayDataSetValues[uiDataSet];
 		dataSet[uiTurn] = iValue;
+#endif
 	}
 }
 
@@ -19628,12 +19859,141 @@ CvPlayer::TurnData CvPlayer::getReplayDataHistory(unsigned int uiDataSet) const
 {
 	if(uiDataSet < m_ReplayDataSetValues.size())
 	{
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+		return m_ReplayDataSetValues[uiDataSet].GetHistory();
+#else
 		return m_ReplayDataSetValues[uiDataSet];
+#endif
 	}
 
 	return CvPlayer::TurnData();
 }
 
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+//	--------------------------------------------------------------------------------
+bool CvPlayer::ReplayDataColumn::GetValue(unsigned int uiTurn, int& iValue) const
+{
+	if(uiTurn < m_uiFirstTurn)
+		return false;
+
+	const unsigned int uiIndex = uiTurn - m_uiFirstTurn;
+	if(uiIndex >= m_aiValues.size() || m_aiValues[uiIndex] == REPLAY_DATA_NO_VALUE)
+		return false;
+
+	iValue = m_aiValues[uiIndex];
+	return true;
+}
+
+//	--------------------------------------------------------------------------------
+void CvPlayer::ReplayDataColumn::SetValue(unsigned int uiTurn, int iValue)
+{
+	CvAssertMsg(iValue != REPLAY_DATA_NO_VALUE, "Replay data value collides with the empty turn marker");
+
+	if(m_aiValues.empty())
+	{
+		m_uiFirstTurn = uiTurn;
+	}
+	else if(uiTurn < m_uiFirstTurn)
+	{
+		if(m_uiFirstTurn - uiTurn + m_aiValues.size() > REPLAY_DATA_MAX_TURN_SPAN)
+		{
+			CvAssertMsg(false, "Replay data turn is too far from the other turns of its dataset");
+			return;
+		}
+		m_aiValues.insert(m_aiValues.begin(), m_uiFirstTurn - uiTurn, REPLAY_DATA_NO_VALUE);
+		m_uiFirstTurn = uiTurn;
+	}
+
+	const unsigned int uiIndex = uiTurn - m_uiFirstTurn;
+	if(uiIndex >= m_aiValues.size())
+	{
+		if(uiIndex >= REPLAY_DATA_MAX_TURN_SPAN)
+		{
+			CvAssertMsg(false, "Replay data turn is too far from the other turns of its dataset");
+			return;
+		}
+		m_aiValues.resize(uiIndex + 1, REPLAY_DATA_NO_VALUE);
+	}
+
+	m_aiValues[uiIndex] = iValue;
+}
+
+//	--------------------------------------------------------------------------------
+CvPlayer::TurnData CvPlayer::ReplayDataColumn::GetHistory() const
+{
+	TurnData history;
+	for(unsigned int uiIndex = 0; uiIndex < m_aiValues.size(); uiIndex++)
+	{
+		if(m_aiValues[uiIndex] != REPLAY_DATA_NO_VALUE)
+			history.insert(history.end(), TurnData::value_type(m_uiFirstTurn + uiIndex, m_aiValues[uiIndex]));
+	}
+
+	return history;
+}
+
+//	--------------------------------------------------------------------------------
+/// Values are stored as the zigzagged difference to the previous turn's value, seven bits per byte, so slowly changing statistics take one byte per turn
+void CvPlayer::ReplayDataColumn::Write(FDataStream& kStream) const
+{
+	std::vector<unsigned char> aucEncoded;
+	aucEncoded.reserve(m_aiValues.size() + m_aiValues.size() / 2);
+
+	unsigned int uiPrevious = 0;
+	for(std::vector<int>::const_iterator it = m_aiValues.begin(); it != m_aiValues.end(); ++it)
+	{
+		// Unsigned arithmetic wraps around, so jumps to and from REPLAY_DATA_NO_VALUE encode like any other delta
+		const int iDelta = (int)((unsigned int)(*it) - uiPrevious);
+		unsigned int uiZigZag = ((unsigned int)iDelta << 1) ^ (unsigned int)(iDelta >> 31);
+		uiPrevious = (unsigned int)(*it);
+
+		while(uiZigZag >= 0x80)
+		{
+			aucEncoded.push_back((unsigned char)(uiZigZag | 0x80));
+			uiZigZag >>= 7;
+		}
+		aucEncoded.push_back((unsigned char)uiZigZag);
+	}
+
+	kStream << m_uiFirstTurn;
+	kStream << m_aiValues.size();
+	kStream << aucEncoded;
+}
+
+//	--------------------------------------------------------------------------------
+void CvPlayer::ReplayDataColumn::Read(FDataStream& kStream)
+{
+	std::vector<unsigned char> aucEncoded;
+	unsigned int uiNumValues;
+
+	kStream >> m_uiFirstTurn;
+	kStream >> uiNumValues;
+	kStream >> aucEncoded;
+
+	m_aiValues.clear();
+	m_aiValues.reserve(uiNumValues);
+
+	unsigned int uiPrevious = 0;
+	std::vector<unsigned char>::const_iterator it = aucEncoded.begin();
+	for(unsigned int uiIndex = 0; uiIndex < uiNumValues && it != aucEncoded.end(); uiIndex++)
+	{
+		unsigned int uiZigZag = 0;
+		int iShift = 0;
+		do
+		{
+			uiZigZag |= (unsigned int)((*it) & 0x7F) << iShift;
+			iShift += 7;
+		}
+		while(((*it++) & 0x80) && it != aucEncoded.end());
+
+		const int iDelta = (int)(uiZigZag >> 1) ^ -(int)(uiZigZag & 1);
+		uiPrevious += (unsigned int)iDelta;
+		m_aiValues.push_back((int)uiPrevious);
+	}
+
+	CvAssertMsg(m_aiValues.size() == uiNumValues, "Replay data column is shorter than its saved size");
+}
+#endif // AUI_PLAYER_COLUMNAR_REPLAY_DATA
+
 //	--------------------------------------------------------------------------------
 std::string CvPlayer::getScriptData() const
 {
@@ -22331,6 +22691,9 @@ void CvPlayer::Read(FDataStream& kStream)
 
 	kStream >> m_cities;
 	kStream >> m_units;
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	RebuildUnitCounters();
+#endif // AUI_PLAYER_UNIT_COUNTERS
 	kStream >> m_armyAIs;
 
 	{
@@ -22358,7 +22721,42 @@ void CvPlayer::Read(FDataStream& kStream)
 	}
 
 	kStream >> m_ReplayDataSets;
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+	if (uiVersion >= 17)
+	{
+		uint uiNumColumns;
+		kStream >> uiNumColumns;
+		m_ReplayDataSetValues.clear();
+		m_ReplayDataSetValues.resize(uiNumColumns);
+		for(uint uiColumn = 0; uiColumn < uiNumColumns; uiColumn++)
+		{
+			m_ReplayDataSetValues[uiColumn].Read(kStream);
+		}
+	}
+	else
+	{
+		std::vector< TurnData > aOldReplayDataSetValues;
+		kStream >> aOldReplayDataSetValues;
+		m_ReplayDataSetValues.clear();
+		m_ReplayDataSetValues.resize(aOldReplayDataSetValues.size());
+		for(uint uiColumn = 0; uiColumn < aOldReplayDataSetValues.size(); uiColumn++)
+		{
+			const TurnData& oldData = aOldReplayDataSetValues[uiColumn];
+			for(TurnData::const_iterator it = oldData.begin(); it != oldData.end(); ++it)
+			{
+				m_ReplayDataSetValues[uiColumn].SetValue((*it).first, (*it).second);
+			}
+		}
+	}
+
+	m_ReplayDataSetIndexes.clear();
+	for(uint uiDataSet = 0; uiDataSet < m_ReplayDataSets.size(); uiDataSet++)
+	{
+		m_ReplayDataSetIndexes[std::string(m_ReplayDataSets[uiDataSet].c_str())] = uiDataSet;
+	}
+#else
 	kStream >> m_ReplayDataSetValues;
+#endif
 
 	kStream >> m_aVote;
 	kStream >> m_aUnitExtraCosts;
@@ -22781,7 +23179,15 @@ void CvPlayer::Write(FDataStream& kStream) const
 	}
 
 	kStream << m_ReplayDataSets;
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+	kStream << m_ReplayDataSetValues.size();
+	for(std::vector<ReplayDataColumn>::const_iterator it = m_ReplayDataSetValues.begin(); it != m_ReplayDataSetValues.end(); ++it)
+	{
+		(*it).Write(kStream);
+	}
+#else
 	kStream << m_ReplayDataSetValues;
+#endif
 
 	kStream << m_aVote;
 	kStream << m_aUnitExtraCosts;
@@ -68,6 +68,23 @@ class CvPlayer
 
 public:
 	typedef std::map<unsigned int, int> TurnData;
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+	/// One replay dataset as a dense column of values, one entry per turn starting at the first turn that has a value
+	struct ReplayDataColumn
+	{
+		ReplayDataColumn() : m_uiFirstTurn(0) {}
+
+		bool GetValue(unsigned int uiTurn, int& iValue) const;
+		void SetValue(unsigned int uiTurn, int iValue);
+		TurnData GetHistory() const;
+
+		void Read(FDataStream& kStream);
+		void Write(FDataStream& kStream) const;
+
+		unsigned int m_uiFirstTurn;
+		std::vector<int> m_aiValues; // turns without a value hold REPLAY_DATA_NO_VALUE
+	};
+#endif
 
 
 	CvPlayer();
@@ -114,6 +131,11 @@ public:
 	int GetNumUnitsWithUnitAI(UnitAITypes eUnitAIType, bool bIncludeBeingTrained = false, bool bIncludeWater = true);
 	int GetNumUnitsWithDomain(DomainTypes eDomain, bool bMilitaryOnly);
 	int GetNumUnitsWithUnitCombat(UnitCombatTypes eDomain);
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	void ChangeUnitCounters(UnitAITypes eUnitAIType, bool bWater, DomainTypes eDomain, bool bCombat, UnitCombatTypes eUnitCombat, int iChange);
+	void ChangeNumUnitsBeingTrained(UnitTypes eUnit, int iChange);
+	void RebuildUnitCounters();
+#endif // AUI_PLAYER_UNIT_COUNTERS
 
 	void InitDangerPlots();
 	void UpdateDangerPlots();
@@ -1211,6 +1233,10 @@ public:
 	const CvCity* getCity(int iID) const;
 	CvCity* addCity();
 	void deleteCity(int iID);
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	int GetBuildableEpoch() const;
+	void BumpBuildableEpoch();
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 	CvCity* GetFirstCityWithBuildingClass(BuildingClassTypes eBuildingClass);
 
 	// unit iteration
@@ -1223,6 +1249,9 @@ public:
 	CvUnit* getUnit(int iID);
 	CvUnit* addUnit();
 	void deleteUnit(int iID);
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+	int GetNewUnitEpoch() const;
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
 
 	// army iteration
 	const CvArmyAI* firstArmyAI(int* pIterIdx, bool bRev=false) const;
@@ -1712,6 +1741,19 @@ protected:
 	FAutoVariable<int, CvPlayer> m_iCultureBombTimer;
 	FAutoVariable<int, CvPlayer> m_iConversionTimer;
 	FAutoVariable<int, CvPlayer> m_iCapitalCityID;
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	int m_iBuildableEpoch; // not saved
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+#ifdef AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+	int m_iNewUnitEpoch; // not saved
+#endif // AUI_MINOR_CIV_QUEST_EVENT_DRIVEN_TESTS
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	// not saved, rebuilt from units and city production queues on load; second index is 1 for naval (UnitAI) or combat (domain) units
+	int m_aaiNumUnitsWithUnitAI[NUM_UNITAI_TYPES][2];
+	int m_aaiNumUnitsBeingTrainedWithUnitAI[NUM_UNITAI_TYPES][2];
+	int m_aaiNumUnitsWithDomain[NUM_DOMAIN_TYPES][2];
+	std::vector<int> m_aiNumUnitsWithUnitCombat;
+#endif // AUI_PLAYER_UNIT_COUNTERS
 	FAutoVariable<int, CvPlayer> m_iCitiesLost;
 	FAutoVariable<int, CvPlayer> m_iMilitaryMight;
 	FAutoVariable<int, CvPlayer> m_iEconomicMight;
@@ -1875,7 +1917,13 @@ protected:
 	std::vector< std::pair<UnitClassTypes, int> > m_aUnitExtraCosts;
 
 	std::vector<CvString> m_ReplayDataSets;
+#ifdef AUI_PLAYER_COLUMNAR_REPLAY_DATA
+	std::vector<ReplayDataColumn> m_ReplayDataSetValues;
+	typedef stdext::hash_map<std::string, unsigned int> ReplayDataSetIndexMap;
+	ReplayDataSetIndexMap m_ReplayDataSetIndexes; // not saved, rebuilt from m_ReplayDataSets on load
+#else
 	std::vector< TurnData > m_ReplayDataSetValues;
+#endif
 
 	void doResearch();
 	void doWarnings();
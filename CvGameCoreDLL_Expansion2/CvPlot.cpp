@@ -4301,6 +4301,9 @@ void CvPlot::setArea(int iNewValue)
 		}
 
 		m_iArea = iNewValue;
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+		GC.getMap().BumpStepPathEpoch();
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 
 		if(area() != NULL)
 		{
@@ -4853,6 +4856,9 @@ void CvPlot::setOwner(PlayerTypes eNewValue, int iAcquiringCityID, bool bCheckUn
 	if(getOwner() != eNewValue)
 	{
 		PlayerTypes eOldOwner = getOwner();;
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+		GC.getMap().BumpStepPathEpoch();
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 
 		GC.getGame().addReplayMessage(REPLAY_MESSAGE_PLOT_OWNER_CHANGE, eNewValue, "", getX(), getY());
 
@@ -5348,6 +5354,12 @@ void CvPlot::setPlotType(PlotTypes eNewValue, bool bRecalculate, bool bRebuildGr
 		updateSeeFromSight(false);
 
 		m_ePlotType = eNewValue;
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+		GC.getMap().BumpStepPathEpoch();
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+		CvEconomicAI::InvalidateExploreFrontier(this, NO_TEAM, true);
+#endif
 
 		updateYield();
 
@@ -5587,6 +5599,12 @@ void CvPlot::setTerrainType(TerrainTypes eNewValue, bool bRecalculate, bool bReb
 		}
 
 		m_eTerrainType = eNewValue;
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+		GC.getMap().BumpStepPathEpoch();
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+		CvEconomicAI::InvalidateExploreFrontier(this, NO_TEAM, true);
+#endif
 
 		updateYield();
 		updateImpassable();
@@ -5636,6 +5654,9 @@ void CvPlot::setFeatureType(FeatureTypes eNewValue, int iVariety)
 		gDLL->GameplayFeatureChanged(pDllPlot.get(), eNewValue);
 
 		m_eFeatureType = eNewValue;
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+		CvEconomicAI::InvalidateExploreFrontier(this, NO_TEAM, true);
+#endif
 
 		updateYield();
 		updateImpassable();
@@ -6039,6 +6060,9 @@ void CvPlot::setImprovementType(ImprovementTypes eNewValue, PlayerTypes eBuilder
 		}
 
 		m_eImprovementType = eNewValue;
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+		CvEconomicAI::InvalidateExploreFrontier(this, NO_TEAM, false);
+#endif
 
 		if(getImprovementType() == NO_IMPROVEMENT)
 		{
@@ -8252,6 +8276,9 @@ bool CvPlot::setRevealed(TeamTypes eTeam, bool bNewValue, bool bTerrainOnly, Tea
 	{
 
 		m_bfRevealed.ToggleBit(eTeam);
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+		CvEconomicAI::InvalidateExploreFrontier(this, eTeam, true);
+#endif
 
 		bool bEligibleForAchievement = GET_PLAYER(GC.getGame().getActivePlayer()).isHuman() && !GC.getGame().isGameMultiPlayer();
 
@@ -8708,6 +8735,9 @@ bool CvPlot::setRevealedImprovementType(TeamTypes eTeam, ImprovementTypes eNewVa
 	if(eOldImprovementType != eNewValue)
 	{
 		m_aeRevealedImprovementType[eTeam] = eNewValue;
+#ifdef AUI_ECONOMIC_INCREMENTAL_EXPLORE_FRONTIER
+		CvEconomicAI::InvalidateExploreFrontier(this, eTeam, false);
+#endif
 		if(eTeam == GC.getGame().getActiveTeam())
 		{
 			updateSymbols();
@@ -11040,6 +11070,9 @@ void CvPlot::updateImpassable()
 {
 	const TerrainTypes eTerrain = getTerrainType();
 	const FeatureTypes eFeature = getFeatureType();
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+	const bool bWasImpassable = m_bIsImpassable;
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 
 	m_bIsImpassable = false;
 
@@ -11058,4 +11091,9 @@ void CvPlot::updateImpassable()
 				m_bIsImpassable = pkFeatureInfo->isImpassable();
 		}
 	}
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+
+	if(m_bIsImpassable != bWasImpassable)
+		GC.getMap().BumpStepPathEpoch();
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 }
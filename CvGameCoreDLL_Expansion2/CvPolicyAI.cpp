@@ -1096,6 +1096,10 @@ void CvPolicyAI::WeightPrereqs(int* paiTempWeights, int iPropagationPercent)
 {
 	int iPolicyLoop;
 
+#if !defined(AUI_POLICY_PREREQ_PROPAGATION_CLOSURE) || defined(AUI_POLICY_PREREQ_PROPAGATION_CLOSURE_VALIDATE)
+#ifdef AUI_POLICY_PREREQ_PROPAGATION_CLOSURE_VALIDATE
+	CvWeightedVector<int, SAFE_ESTIMATE_NUM_POLICIES, true> kWeightsBefore = m_PolicyAIWeights;
+#endif // AUI_POLICY_PREREQ_PROPAGATION_CLOSURE_VALIDATE
 	// Loop through policies looking for ones that are just getting some new weight
 	for(iPolicyLoop = 0; iPolicyLoop < m_pCurrentPolicies->GetPolicies()->GetNumPolicies(); iPolicyLoop++)
 	{
@@ -1105,6 +1109,45 @@ void CvPolicyAI::WeightPrereqs(int* paiTempWeights, int iPropagationPercent)
 			PropagateWeights(iPolicyLoop, paiTempWeights[iPolicyLoop], iPropagationPercent, 0);
 		}
 	}
+#ifdef AUI_POLICY_PREREQ_PROPAGATION_CLOSURE_VALIDATE
+	CvWeightedVector<int, SAFE_ESTIMATE_NUM_POLICIES, true> kRecursiveWeights = m_PolicyAIWeights;
+	m_PolicyAIWeights = kWeightsBefore;
+#endif // AUI_POLICY_PREREQ_PROPAGATION_CLOSURE_VALIDATE
+#endif // !AUI_POLICY_PREREQ_PROPAGATION_CLOSURE || AUI_POLICY_PREREQ_PROPAGATION_CLOSURE_VALIDATE
+#ifdef AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
+	CvPolicyXMLEntries* pkEntries = m_pCurrentPolicies->GetPolicies();
+	for(iPolicyLoop = 0; iPolicyLoop < m_pCurrentPolicies->GetPolicies()->GetNumPolicies(); iPolicyLoop++)
+	{
+		if(paiTempWeights[iPolicyLoop] > 0)
+		{
+			const std::vector<CvPolicyXMLEntries::PrereqPropagationStep>& aSteps = pkEntries->GetPrereqPropagationSteps(iPolicyLoop, m_iPolicyWeightPropagationLevels);
+
+			// Weight reaching depth N is the policy's weight cut by iPropagationPercent N times (same integer truncation as the recursion), and it only spreads further while positive
+			int iDepth = 0;
+			int iDepthWeight = paiTempWeights[iPolicyLoop];
+			for(std::vector<CvPolicyXMLEntries::PrereqPropagationStep>::const_iterator it = aSteps.begin(); it != aSteps.end(); ++it)
+			{
+				while(iDepth < it->m_iDepth)
+				{
+					iDepthWeight = (iDepthWeight > 0) ? iDepthWeight * iPropagationPercent / 100 : 0;
+					iDepth++;
+				}
+				if(iDepthWeight == 0)
+				{
+					break;
+				}
+
+				m_PolicyAIWeights.IncreaseWeight(it->m_iPrereq, iDepthWeight * it->m_iCount);
+			}
+		}
+	}
+#endif // AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
+#ifdef AUI_POLICY_PREREQ_PROPAGATION_CLOSURE_VALIDATE
+	for(iPolicyLoop = 0; iPolicyLoop < m_pCurrentPolicies->GetPolicies()->GetNumPolicies(); iPolicyLoop++)
+	{
+		CvAssertMsg(m_PolicyAIWeights.GetWeight(iPolicyLoop) == kRecursiveWeights.GetWeight(iPolicyLoop), "Precomputed prerequisite propagation does not match the recursive one");
+	}
+#endif // AUI_POLICY_PREREQ_PROPAGATION_CLOSURE_VALIDATE
 }
 
 /// Recursive routine to weight all prerequisite policies
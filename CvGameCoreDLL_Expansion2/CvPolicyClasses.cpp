@@ -1901,6 +1901,9 @@ bool CvPolicyBranchEntry::IsDelayWhenNoScience() const
 //=====================================
 /// Constructor
 CvPolicyXMLEntries::CvPolicyXMLEntries(void)
+#ifdef AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
+	: m_iPrereqPropagationLevels(-1)
+#endif // AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
 {
 
 }
@@ -1933,6 +1936,10 @@ void CvPolicyXMLEntries::DeletePoliciesArray()
 	}
 
 	m_paPolicyEntries.clear();
+#ifdef AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
+	m_aaPrereqPropagationSteps.clear();
+	m_iPrereqPropagationLevels = -1;
+#endif // AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
 }
 
 /// Get a specific entry
@@ -1941,6 +1948,66 @@ CvPolicyEntry* CvPolicyXMLEntries::GetPolicyEntry(int index)
 	return m_paPolicyEntries[index];
 }
 
+#ifdef AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
+/// Every prerequisite that weight propagation from this policy reaches, with the number of paths reaching it at each depth (sorted by depth); built on first use and rebuilt if the level limit changes
+const std::vector<CvPolicyXMLEntries::PrereqPropagationStep>& CvPolicyXMLEntries::GetPrereqPropagationSteps(int iPolicy, int iPropagationLevels)
+{
+	if(m_iPrereqPropagationLevels != iPropagationLevels || (int)m_aaPrereqPropagationSteps.size() != GetNumPolicies())
+	{
+		m_aaPrereqPropagationSteps.clear();
+		m_aaPrereqPropagationSteps.resize(GetNumPolicies());
+
+		for(int iLoop = 0; iLoop < GetNumPolicies(); iLoop++)
+		{
+			// Keyed by (depth, prerequisite) so the flattened list comes out sorted by depth
+			std::map<std::pair<int, int>, int> kSteps;
+			AddPrereqPropagationStepsInternal(kSteps, iLoop, 0, 0, iPropagationLevels);
+
+			std::vector<PrereqPropagationStep>& aSteps = m_aaPrereqPropagationSteps[iLoop];
+			aSteps.reserve(kSteps.size());
+			for(std::map<std::pair<int, int>, int>::const_iterator it = kSteps.begin(); it != kSteps.end(); ++it)
+			{
+				PrereqPropagationStep kStep;
+				kStep.m_iPrereq = it->first.second;
+				kStep.m_iDepth = it->first.first;
+				kStep.m_iCount = it->second;
+				aSteps.push_back(kStep);
+			}
+		}
+
+		m_iPrereqPropagationLevels = iPropagationLevels;
+	}
+
+	return m_aaPrereqPropagationSteps[iPolicy];
+}
+
+/// Mirrors the recursion in CvPolicyAI::PropagateWeights(), including how it advances the propagation level for each successive prerequisite
+void CvPolicyXMLEntries::AddPrereqPropagationStepsInternal(std::map<std::pair<int, int>, int>& kSteps, int iIndex, int iDepth, int iPropagationLevel, int iPropagationLevels)
+{
+	// No path in a well-formed tree is longer than the number of policies; stops runaway recursion on cyclic modded data
+	if(iPropagationLevel >= iPropagationLevels || iDepth >= GetNumPolicies())
+	{
+		return;
+	}
+
+	CvPolicyEntry* pkEntry = GetPolicyEntry(iIndex);
+	if(pkEntry)
+	{
+		for(int iI = 0; iI < GC.getNUM_OR_TECH_PREREQS(); iI++)
+		{
+			int iPrereq = pkEntry->GetPrereqAndPolicies(iI);
+			if(iPrereq == NO_POLICY)
+			{
+				break;
+			}
+
+			kSteps[std::make_pair(iDepth + 1, iPrereq)]++;
+			AddPrereqPropagationStepsInternal(kSteps, iPrereq, iDepth + 1, iPropagationLevel++, iPropagationLevels);
+		}
+	}
+}
+#endif // AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
+
 /// Returns vector of PolicyBranch entries
 std::vector<CvPolicyBranchEntry*>& CvPolicyXMLEntries::GetPolicyBranchEntries()
 {
@@ -2247,6 +2314,9 @@ void CvPlayerPolicies::SetPolicy(PolicyTypes eIndex, bool bNewValue)
 	if(HasPolicy(eIndex) != bNewValue)
 	{
 		m_pabHasPolicy[eIndex] = bNewValue;
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+		m_pPlayer->BumpBuildableEpoch();
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 
 		int iChange = bNewValue ? 1 : -1;
 		GetPlayer()->ChangeNumPolicies(iChange);
@@ -3191,6 +3261,9 @@ void CvPlayerPolicies::SetPolicyBranchUnlocked(PolicyBranchTypes eBranchType, bo
 		}
 
 		m_pabPolicyBranchUnlocked[eBranchType] = bNewValue;
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+		m_pPlayer->BumpBuildableEpoch();
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 	}
 }
 
@@ -3459,6 +3532,9 @@ void CvPlayerPolicies::SetPolicyBranchFinished(PolicyBranchTypes eBranchType, bo
 	if(bValue != IsPolicyBranchFinished(eBranchType))
 	{
 		m_pabPolicyBranchFinished[eBranchType] = bValue;
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+		m_pPlayer->BumpBuildableEpoch();
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 
 
 		bool bUsingXP1Scenario3 = gDLL->IsModActivated(CIV5_XP1_SCENARIO3_MODID);
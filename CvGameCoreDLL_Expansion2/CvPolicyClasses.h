@@ -483,9 +483,25 @@ public:
 
 	void DeletePolicyBranchesArray();
 
+#ifdef AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
+	struct PrereqPropagationStep
+	{
+		int m_iPrereq;
+		int m_iDepth;
+		int m_iCount;
+	};
+	const std::vector<PrereqPropagationStep>& GetPrereqPropagationSteps(int iPolicy, int iPropagationLevels);
+#endif // AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
+
 private:
 	std::vector<CvPolicyEntry*> m_paPolicyEntries;
 	std::vector<CvPolicyBranchEntry*> m_paPolicyBranchEntries;
+#ifdef AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
+	void AddPrereqPropagationStepsInternal(std::map<std::pair<int, int>, int>& kSteps, int iIndex, int iDepth, int iPropagationLevel, int iPropagationLevels);
+
+	std::vector< std::vector<PrereqPropagationStep> > m_aaPrereqPropagationSteps;
+	int m_iPrereqPropagationLevels; // level limit the steps were built for (-1 if not built)
+#endif // AUI_POLICY_PREREQ_PROPAGATION_CLOSURE
 };
 
 enum PolicyModifierType
@@ -2523,7 +2523,7 @@ void CvTacticalAI::PlotMovesToSafety(bool bCombatUnits)
 	int iAcceptableDanger;
 #endif // AUI_TACTICAL_TWEAKED_ACCEPTABLE_DANGER
 
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	m_CurrentMoveUnits.clear();
 
 	// Loop through all recruited units
@@ -2609,7 +2609,7 @@ void CvTacticalAI::PlotMovesToSafety(bool bCombatUnits)
 /// Move units to a better location
 void CvTacticalAI::PlotRepositionMoves()
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	CvTacticalUnit unit;
 
 	m_CurrentMoveUnits.clear();
@@ -2644,7 +2644,7 @@ void CvTacticalAI::PlotRepositionMoves()
 /// Move barbarians across the map
 void CvTacticalAI::PlotBarbarianMove(bool bAggressive)
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	CvTacticalUnit unit;
 
 	if(m_pPlayer->isBarbarian())
@@ -2672,7 +2672,7 @@ void CvTacticalAI::PlotBarbarianMove(bool bAggressive)
 /// Escort captured civilians back to barbarian camps
 void CvTacticalAI::PlotBarbarianCivilianEscortMove()
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	CvTacticalUnit unit;
 
 	if(m_pPlayer->isBarbarian())
@@ -2754,7 +2754,7 @@ void CvTacticalAI::PlotBarbarianPlunderTradeUnitMove(DomainTypes eDomain)
 /// Process units that we recruited out of operational moves.  Haven't used them, so let them go ahead with those moves
 void CvTacticalAI::PlotOperationalArmyMoves()
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 
 	// Update all operations (moved down - previously was in the PlayerAI object)
 	CvAIOperation* nextOp = NULL;
@@ -3172,7 +3172,7 @@ void CvTacticalAI::PlotSafeBombardMoves()
 /// Assigns units to heal
 void CvTacticalAI::PlotHealMoves()
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	m_CurrentMoveUnits.clear();
 	CvTacticalUnit unit;
 
@@ -3379,7 +3379,7 @@ void CvTacticalAI::PlotAncientRuinMoves(int iNumTurnsAway)
 /// Set fighters to intercept
 void CvTacticalAI::PlotAirInterceptMoves()
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	m_CurrentMoveUnits.clear();
 	CvTacticalUnit unit;
 #ifdef AUI_TACTICAL_TWEAKED_AIR_INTERCEPT
@@ -3463,7 +3463,7 @@ void CvTacticalAI::PlotAirInterceptMoves()
 /// Set fighters to air sweep
 void CvTacticalAI::PlotAirSweepMoves()
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	m_CurrentMoveUnits.clear();
 	CvTacticalUnit unit;
 	CvTacticalDominanceZone *pZone;
@@ -3605,7 +3605,7 @@ void CvTacticalAI::PlotEmergencyPurchases()
 void CvTacticalAI::PlotDefensiveAirlifts()
 {
 	vector<int> aProcessedUnits;
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	CvTacticalUnit unit;
 	CvCity* pCity;
 
@@ -3663,7 +3663,7 @@ void CvTacticalAI::PlotDefensiveAirlifts()
 /// Move naval units over top of unprotected embarked units
 void CvTacticalAI::PlotEscortEmbarkedMoves()
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	m_CurrentMoveUnits.clear();
 	CvTacticalUnit unit;
 
@@ -3990,7 +3990,7 @@ void CvTacticalAI::PlotCounterattackMoves()
 /// Withdraw out of current dominance zone
 void CvTacticalAI::PlotWithdrawMoves()
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	m_CurrentMoveUnits.clear();
 	CvTacticalUnit unit;
 
@@ -4141,7 +4141,7 @@ void CvTacticalAI::PlotCloseOnTarget(bool bCheckDominance)
 /// Log that we couldn't find assignments for some units
 void CvTacticalAI::ReviewUnassignedUnits()
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 
 	// Loop through all remaining units
 	for(it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); it++)
@@ -9194,7 +9194,7 @@ bool CvTacticalAI::ExecuteSafeBombards(CvTacticalTarget& kTarget)
 	// For each of our ranged units, see if they are already in a plot that can bombard that can't be attacked.
 	// If so, bombs away!
 	m_CurrentMoveUnits.clear();
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	for(it = m_CurrentTurnUnits.begin(); it != m_CurrentTurnUnits.end(); it++)
 	{
 		UnitHandle pUnit = m_pPlayer->getUnit(*it);
@@ -9914,7 +9914,7 @@ void CvTacticalAI::ExecuteCloseOnTarget(CvTacticalTarget& kTarget, CvTacticalDom
 	int iRangedUnits = 0;
 	int iMeleeUnits = 0;
 	int iGenerals = 0;
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	int iTacticalRadius = GC.getGame().GetTacticalAnalysisMap()->GetTacticalRange();
 
 	pTargetPlot = GC.getMap().plot(kTarget.GetTargetX(), kTarget.GetTargetY());
@@ -10073,7 +10073,7 @@ void CvTacticalAI::ExecuteHedgehogDefense(CvTacticalTarget& kTarget, CvTacticalD
 	CvPlot* pTargetPlot;
 	int iRangedUnits = 0;
 	int iMeleeUnits = 0;
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	int iTacticalRadius = GC.getGame().GetTacticalAnalysisMap()->GetTacticalRange();
 
 	pTargetPlot = GC.getMap().plot(kTarget.GetTargetX(), kTarget.GetTargetY());
@@ -10446,7 +10446,7 @@ bool CvTacticalAI::FindUnitsForThisMove(TacticalAIMoveTypes eMove, CvPlot* pTarg
 	UnitHandle pLoopUnit;
 	bool rtnValue = false;
 
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	m_CurrentMoveUnits.clear();
 	m_CurrentMoveHighPriorityUnits.clear();
 
@@ -10606,7 +10606,7 @@ bool CvTacticalAI::FindUnitsWithinStrikingDistance(CvPlot* pTarget, int iNumTurn
 bool CvTacticalAI::FindUnitsWithinStrikingDistance(CvPlot* pTarget, int iNumTurnsAway, int iPreferredDamageLevel, bool bNoRangedUnits, bool bNavalOnly, bool bMustMoveThrough, bool bIncludeBlockedUnits, bool bWillPillage, bool bTargetUndefended)
 #endif // AUI_ASTAR_PARADROP
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	UnitHandle pLoopUnit;
 
 	bool rtnValue = false;
@@ -10868,7 +10868,7 @@ bool CvTacticalAI::FindUnitsWithinStrikingDistance(CvPlot* pTarget, int iNumTurn
 /// Fills m_CurrentMoveCities with all cities within bombard range of a target (returns TRUE if 1 or more found)
 bool CvTacticalAI::FindCitiesWithinStrikingDistance(CvPlot* pTargetPlot)
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	CvCity* pLoopCity;
 	int iLoop;
 
@@ -10897,7 +10897,7 @@ bool CvTacticalAI::FindCitiesWithinStrikingDistance(CvPlot* pTargetPlot)
 /// Fills m_CurrentMoveUnits with all paratrooper units (available to jump) to the target (returns TRUE if 1 or more found)
 bool CvTacticalAI::FindParatroopersWithinStrikingDistance(CvPlot* pTarget)
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	UnitHandle pLoopUnit;
 
 	bool rtnValue = false;
@@ -10935,7 +10935,7 @@ bool CvTacticalAI::FindParatroopersWithinStrikingDistance(CvPlot* pTarget)
 /// Fills m_CurrentMoveUnits with all units within X turns of a target (returns TRUE if 1 or more found)
 bool CvTacticalAI::FindClosestUnit(CvPlot* pTarget, int iNumTurnsAway, bool bMustHaveHalfHP, bool bMustBeRangedUnit, int iRangeRequired, bool bNeedsIgnoreLOS, bool bMustBeMeleeUnit, bool bIgnoreUnits, CvPlot* pRangedAttackTarget)
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	UnitHandle pLoopUnit;
 
 	bool rtnValue = false;
@@ -11316,7 +11316,7 @@ bool CvTacticalAI::FindClosestNavalOperationUnit(CvPlot* pTarget, bool bEscorted
 //AMS: Fills m_CurrentAirUnits with all units able to sweep at target plot.
 bool CvTacticalAI::FindAirUnitsToAirSweep(CvPlot* pTarget)
 {
-	list<int>::iterator it;
+	CvUnitIDList::iterator it;
 	UnitHandle pLoopUnit;
 	bool rtnValue = false;
 	m_CurrentAirUnits.clear();
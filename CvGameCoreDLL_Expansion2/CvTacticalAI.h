@@ -762,6 +762,13 @@ enum TacticalAIInfoTypes
 
 typedef FStaticVector<CvTacticalTarget, 256, false, c_eCiv5GameplayDLL > TacticalList;
 
+// IDs of the units the tactical and homeland AIs still have to move this turn
+#ifdef AUI_AI_UNIT_ID_LIST_NODE_POOL
+typedef std::list<int, CvNodePoolAllocator<int> > CvUnitIDList;
+#else
+typedef std::list<int> CvUnitIDList;
+#endif
+
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  CLASS:      CvTacticalAI
 //!  \brief		A player's AI to control units as they fight out battles
@@ -1018,7 +1025,7 @@ private:
 	// Class data
 	CvPlayer* m_pPlayer;
 	CvTacticalAnalysisMap* m_pMap;
-	list<int> m_CurrentTurnUnits;
+	CvUnitIDList m_CurrentTurnUnits;
 	std::vector<CvTacticalUnit> m_CurrentMoveUnits;
 	std::vector<CvTacticalUnit> m_CurrentMoveHighPriorityUnits;
 	std::vector<CvTacticalCity> m_CurrentMoveCities;
@@ -859,6 +859,35 @@ void CvTacticalAnalysisMap::CalculateMilitaryStrengths()
 
 	eTeam = m_pPlayer->getTeam();
 
+#ifdef AUI_TACTICAL_ANALYSIS_MAP_CALCULATE_MILITARY_STRENGTHS_UNIT_BUCKETS
+	// Combat units that can count towards land zones (index 0) or water zones (index 1); air units go in both
+	std::vector<CvUnit*> aapZoneUnits[MAX_PLAYERS][2];
+	for(int iPlayerLoop = 0; iPlayerLoop < MAX_PLAYERS; iPlayerLoop++)
+	{
+		CvPlayer& kPlayer = GET_PLAYER((PlayerTypes) iPlayerLoop);
+		if(kPlayer.GetID() != m_pPlayer->GetID() && (iPlayerLoop >= MAX_CIV_PLAYERS || !GET_TEAM(eTeam).isAtWar(kPlayer.getTeam())))
+		{
+			continue;
+		}
+
+		for(pLoopUnit = kPlayer.firstUnit(&iLoop); pLoopUnit != NULL; pLoopUnit = kPlayer.nextUnit(&iLoop))
+		{
+			if(pLoopUnit->IsCombatUnit())
+			{
+				DomainTypes eDomain = pLoopUnit->getDomainType();
+				if(eDomain == DOMAIN_AIR || eDomain == DOMAIN_LAND)
+				{
+					aapZoneUnits[iPlayerLoop][0].push_back(pLoopUnit);
+				}
+				if(eDomain == DOMAIN_AIR || eDomain == DOMAIN_SEA)
+				{
+					aapZoneUnits[iPlayerLoop][1].push_back(pLoopUnit);
+				}
+			}
+		}
+	}
+#endif // AUI_TACTICAL_ANALYSIS_MAP_CALCULATE_MILITARY_STRENGTHS_UNIT_BUCKETS
+
 	for(unsigned int iI = 0; iI < m_DominanceZones.size(); iI++)
 	{
 		pZone = &m_DominanceZones[iI];
@@ -894,8 +923,15 @@ void CvTacticalAnalysisMap::CalculateMilitaryStrengths()
 				}
 
 				// Loop through all of OUR units first
+#ifdef AUI_TACTICAL_ANALYSIS_MAP_CALCULATE_MILITARY_STRENGTHS_UNIT_BUCKETS
+				const std::vector<CvUnit*>& apFriendlyUnits = aapZoneUnits[m_pPlayer->GetID()][pZone->IsWater() ? 1 : 0];
+				for(std::vector<CvUnit*>::const_iterator itUnit = apFriendlyUnits.begin(); itUnit != apFriendlyUnits.end(); ++itUnit)
+				{
+					pLoopUnit = *itUnit;
+#else
 				for(pLoopUnit = m_pPlayer->firstUnit(&iLoop); pLoopUnit != NULL; pLoopUnit = m_pPlayer->nextUnit(&iLoop))
 				{
+#endif // AUI_TACTICAL_ANALYSIS_MAP_CALCULATE_MILITARY_STRENGTHS_UNIT_BUCKETS
 					if(pLoopUnit->IsCombatUnit())
 					{
 						if(pLoopUnit->getDomainType() == DOMAIN_AIR ||
@@ -972,8 +1008,15 @@ void CvTacticalAnalysisMap::CalculateMilitaryStrengths()
 					CvPlayer& kPlayer = GET_PLAYER((PlayerTypes) iPlayerLoop);
 					if(GET_TEAM(eTeam).isAtWar(kPlayer.getTeam()))
 					{
+#ifdef AUI_TACTICAL_ANALYSIS_MAP_CALCULATE_MILITARY_STRENGTHS_UNIT_BUCKETS
+						const std::vector<CvUnit*>& apEnemyUnits = aapZoneUnits[iPlayerLoop][pZone->IsWater() ? 1 : 0];
+						for(std::vector<CvUnit*>::const_iterator itUnit = apEnemyUnits.begin(); itUnit != apEnemyUnits.end(); ++itUnit)
+						{
+							pLoopUnit = *itUnit;
+#else
 						for(pLoopUnit = kPlayer.firstUnit(&iLoop); pLoopUnit != NULL; pLoopUnit = kPlayer.nextUnit(&iLoop))
 						{
+#endif // AUI_TACTICAL_ANALYSIS_MAP_CALCULATE_MILITARY_STRENGTHS_UNIT_BUCKETS
 							if(pLoopUnit->IsCombatUnit())
 							{
 								if(pLoopUnit->getDomainType() == DOMAIN_AIR ||
@@ -226,6 +226,9 @@ void CvTeam::reset(TeamTypes eID, bool bConstructorCall)
 	uninit();
 
 	m_eID = eID;
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	m_iBuildableEpoch = 0;
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 
 	if(!bConstructorCall)
 	{
@@ -3561,6 +3564,9 @@ void CvTeam::setAtWar(TeamTypes eIndex, bool bNewValue)
 	CvAssertMsg(eIndex != GetID() || bNewValue == false, "Team is setting war with itself!");
 	if(eIndex != GetID() || bNewValue == false)
 		m_abAtWar[eIndex] = bNewValue;
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+	GC.getMap().BumpStepPathEpoch();
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 
 	gDLL->GameplayWarStateChanged(GetID(), eIndex, bNewValue);
 
@@ -3926,6 +3932,9 @@ void CvTeam::SetAllowsOpenBordersToTeam(TeamTypes eIndex, bool bNewValue)
 	if(IsAllowsOpenBordersToTeam(eIndex) != bNewValue)
 	{
 		m_abOpenBorders[eIndex] = bNewValue;
+#ifdef AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
+		GC.getMap().BumpStepPathEpoch();
+#endif // AUI_MILITARY_ATTACK_TARGET_PATH_CACHE
 
 		GC.getMap().verifyUnitValidPlot();
 
@@ -4572,6 +4581,21 @@ bool CvTeam::isObsoleteBuilding(BuildingTypes eIndex) const
 	return (getObsoleteBuildingCount(eIndex) > 0);
 }
 
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+//	--------------------------------------------------------------------------------
+/// Changes whenever a tech is gained or lost or a building becomes obsolete (only differences between two reads are meaningful, value is not saved)
+int CvTeam::GetBuildableEpoch() const
+{
+	return m_iBuildableEpoch;
+}
+
+//	--------------------------------------------------------------------------------
+void CvTeam::BumpBuildableEpoch()
+{
+	m_iBuildableEpoch++;
+}
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+
 
 //	--------------------------------------------------------------------------------
 void CvTeam::changeObsoleteBuildingCount(BuildingTypes eIndex, int iChange)
@@ -4590,6 +4614,9 @@ void CvTeam::changeObsoleteBuildingCount(BuildingTypes eIndex, int iChange)
 
 		m_paiObsoleteBuildingCount[eIndex] = (m_paiObsoleteBuildingCount[eIndex] + iChange);
 		CvAssert(getObsoleteBuildingCount(eIndex) >= 0);
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+		BumpBuildableEpoch();
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 
 		if(bOldObsoleteBuilding != isObsoleteBuilding(eIndex))
 		{
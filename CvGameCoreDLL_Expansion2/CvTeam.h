@@ -325,6 +325,10 @@ public:
 
 	int getObsoleteBuildingCount(BuildingTypes eIndex) const;
 	bool isObsoleteBuilding(BuildingTypes eIndex) const;
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	int GetBuildableEpoch() const;
+	void BumpBuildableEpoch();
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 	void changeObsoleteBuildingCount(BuildingTypes eIndex, int iChange);
 
 	void enhanceBuilding(BuildingTypes eIndex, int iChange);
@@ -510,6 +514,9 @@ protected:
 	int* m_paiUnitClassCount;
 	int* m_paiBuildingClassCount;
 	int* m_paiObsoleteBuildingCount;
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+	int m_iBuildableEpoch; // not saved
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 	int* m_paiTerrainTradeCount;
 	int* m_aiVictoryCountdown;
 
@@ -179,7 +179,11 @@ TechTypes CvTechAI::ChooseNextTech(CvPlayer *pPlayer, bool bFreeTech)
 		ReweightByCost(pPlayer);
 #endif // AUI_TECHAI_CHOOSE_NEXT_TECH_FREE_TECH_WANTS_EXPENSIVE
 
+#ifdef AUI_WEIGHTED_VECTOR_PARTIAL_SORT_TOP_CHOICES
+	m_ResearchableTechs.StableSortTopItems(GC.getGame().getHandicapInfo().GetTechNumOptions());
+#else
 	m_ResearchableTechs.SortItems();
+#endif // AUI_WEIGHTED_VECTOR_PARTIAL_SORT_TOP_CHOICES
 	LogPossibleResearch();
 
 	// If total weight is above 0, choose one above a threshold
@@ -350,6 +354,10 @@ void CvTechAI::WeightPrereqs(int* paiTempWeights, int iPropagationPercent)
 {
 	int iTechLoop;
 
+#if !defined(AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE) || defined(AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE_VALIDATE)
+#ifdef AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE_VALIDATE
+	CvWeightedVector<int, SAFE_ESTIMATE_NUM_TECHS, true> kWeightsBefore = m_TechAIWeights;
+#endif // AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE_VALIDATE
 	// Loop through techs looking for ones that are just getting some new weight
 	for(iTechLoop = 0; iTechLoop < m_pCurrentTechs->GetTechs()->GetNumTechs(); iTechLoop++)
 	{
@@ -359,6 +367,45 @@ void CvTechAI::WeightPrereqs(int* paiTempWeights, int iPropagationPercent)
 			PropagateWeights(iTechLoop, paiTempWeights[iTechLoop], iPropagationPercent, 0);
 		}
 	}
+#ifdef AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE_VALIDATE
+	CvWeightedVector<int, SAFE_ESTIMATE_NUM_TECHS, true> kRecursiveWeights = m_TechAIWeights;
+	m_TechAIWeights = kWeightsBefore;
+#endif // AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE_VALIDATE
+#endif // !AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE || AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE_VALIDATE
+#ifdef AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
+	CvTechXMLEntries* pkEntries = m_pCurrentTechs->GetTechs();
+	for(iTechLoop = 0; iTechLoop < m_pCurrentTechs->GetTechs()->GetNumTechs(); iTechLoop++)
+	{
+		if(paiTempWeights[iTechLoop] > 0)
+		{
+			const std::vector<CvTechXMLEntries::PrereqPropagationStep>& aSteps = pkEntries->GetPrereqPropagationSteps(iTechLoop, GC.getTECH_WEIGHT_PROPAGATION_LEVELS());
+
+			// Weight reaching depth N is the tech's weight cut by iPropagationPercent N times (same integer truncation as the recursion), and it only spreads further while positive
+			int iDepth = 0;
+			int iDepthWeight = paiTempWeights[iTechLoop];
+			for(std::vector<CvTechXMLEntries::PrereqPropagationStep>::const_iterator it = aSteps.begin(); it != aSteps.end(); ++it)
+			{
+				while(iDepth < it->m_iDepth)
+				{
+					iDepthWeight = (iDepthWeight > 0) ? iDepthWeight * iPropagationPercent / 100 : 0;
+					iDepth++;
+				}
+				if(iDepthWeight == 0)
+				{
+					break;
+				}
+
+				m_TechAIWeights.IncreaseWeight(it->m_iPrereq, iDepthWeight * it->m_iCount);
+			}
+		}
+	}
+#endif // AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
+#ifdef AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE_VALIDATE
+	for(iTechLoop = 0; iTechLoop < m_pCurrentTechs->GetTechs()->GetNumTechs(); iTechLoop++)
+	{
+		CvAssertMsg(m_TechAIWeights.GetWeight(iTechLoop) == kRecursiveWeights.GetWeight(iTechLoop), "Precomputed prerequisite propagation does not match the recursive one");
+	}
+#endif // AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE_VALIDATE
 }
 
 /// Recursive routine to weight all prerequisite techs
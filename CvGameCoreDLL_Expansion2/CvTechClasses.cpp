@@ -539,6 +539,9 @@ int CvTechEntry::GetPrereqAndTechs(int i) const
 //=====================================
 /// Constructor
 CvTechXMLEntries::CvTechXMLEntries(void)
+#ifdef AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
+	: m_iPrereqPropagationLevels(-1)
+#endif // AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
 {
 
 }
@@ -570,6 +573,10 @@ void CvTechXMLEntries::DeleteArray()
 	}
 
 	m_paTechEntries.clear();
+#ifdef AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
+	m_aaPrereqPropagationSteps.clear();
+	m_iPrereqPropagationLevels = -1;
+#endif // AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
 }
 
 /// Get a specific entry
@@ -578,6 +585,66 @@ CvTechEntry* CvTechXMLEntries::GetEntry(int index)
 	return m_paTechEntries[index];
 }
 
+#ifdef AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
+/// Every prerequisite that weight propagation from this tech reaches, with the number of paths reaching it at each depth (sorted by depth); built on first use and rebuilt if the level limit changes
+const std::vector<CvTechXMLEntries::PrereqPropagationStep>& CvTechXMLEntries::GetPrereqPropagationSteps(int iTech, int iPropagationLevels)
+{
+	if(m_iPrereqPropagationLevels != iPropagationLevels || (int)m_aaPrereqPropagationSteps.size() != GetNumTechs())
+	{
+		m_aaPrereqPropagationSteps.clear();
+		m_aaPrereqPropagationSteps.resize(GetNumTechs());
+
+		for(int iLoop = 0; iLoop < GetNumTechs(); iLoop++)
+		{
+			// Keyed by (depth, prerequisite) so the flattened list comes out sorted by depth
+			std::map<std::pair<int, int>, int> kSteps;
+			AddPrereqPropagationStepsInternal(kSteps, iLoop, 0, 0, iPropagationLevels);
+
+			std::vector<PrereqPropagationStep>& aSteps = m_aaPrereqPropagationSteps[iLoop];
+			aSteps.reserve(kSteps.size());
+			for(std::map<std::pair<int, int>, int>::const_iterator it = kSteps.begin(); it != kSteps.end(); ++it)
+			{
+				PrereqPropagationStep kStep;
+				kStep.m_iPrereq = it->first.second;
+				kStep.m_iDepth = it->first.first;
+				kStep.m_iCount = it->second;
+				aSteps.push_back(kStep);
+			}
+		}
+
+		m_iPrereqPropagationLevels = iPropagationLevels;
+	}
+
+	return m_aaPrereqPropagationSteps[iTech];
+}
+
+/// Mirrors the recursion in CvTechAI::PropagateWeights(), including how it advances the propagation level for each successive prerequisite
+void CvTechXMLEntries::AddPrereqPropagationStepsInternal(std::map<std::pair<int, int>, int>& kSteps, int iIndex, int iDepth, int iPropagationLevel, int iPropagationLevels)
+{
+	// No path in a well-formed tree is longer than the number of techs; stops runaway recursion on cyclic modded data
+	if(iPropagationLevel >= iPropagationLevels || iDepth >= GetNumTechs())
+	{
+		return;
+	}
+
+	CvTechEntry* pkEntry = GetEntry(iIndex);
+	if(pkEntry)
+	{
+		for(int iI = 0; iI < GC.getNUM_OR_TECH_PREREQS(); iI++)
+		{
+			int iPrereq = pkEntry->GetPrereqAndTechs(iI);
+			if(iPrereq == NO_TECH)
+			{
+				break;
+			}
+
+			kSteps[std::make_pair(iDepth + 1, iPrereq)]++;
+			AddPrereqPropagationStepsInternal(kSteps, iPrereq, iDepth + 1, iPropagationLevel++, iPropagationLevels);
+		}
+	}
+}
+#endif // AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
+
 
 //=====================================
 // CvPlayerTechs
@@ -1828,6 +1895,9 @@ void CvTeamTechs::SetHasTech(TechTypes eIndex, bool bNewValue)
 	if(m_pabHasTech[eIndex] != bNewValue)
 	{
 		m_pabHasTech[eIndex] = bNewValue;
+#ifdef AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
+		m_pTeam->BumpBuildableEpoch();
+#endif // AUI_CITYSTRATEGY_BUILDABLE_CANDIDATE_CACHE
 
 		if(bNewValue)
 			SetLastTechAcquired(eIndex);
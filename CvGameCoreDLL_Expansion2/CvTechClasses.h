@@ -182,8 +182,24 @@ public:
 
 	void DeleteArray();
 
+#ifdef AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
+	struct PrereqPropagationStep
+	{
+		int m_iPrereq;
+		int m_iDepth;
+		int m_iCount;
+	};
+	const std::vector<PrereqPropagationStep>& GetPrereqPropagationSteps(int iTech, int iPropagationLevels);
+#endif // AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
+
 private:
 	std::vector<CvTechEntry*> m_paTechEntries;
+#ifdef AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
+	void AddPrereqPropagationStepsInternal(std::map<std::pair<int, int>, int>& kSteps, int iIndex, int iDepth, int iPropagationLevel, int iPropagationLevels);
+
+	std::vector< std::vector<PrereqPropagationStep> > m_aaPrereqPropagationSteps;
+	int m_iPrereqPropagationLevels; // level limit the steps were built for (-1 if not built)
+#endif // AUI_TECHAI_PREREQ_PROPAGATION_CLOSURE
 };
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -41,6 +41,10 @@ CvTreasury::~CvTreasury()
 /// Initialize
 void CvTreasury::Init(CvPlayer* pPlayer)
 {
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+	// Gold is reset directly, so take the old balance's contribution out of the rolling checksum first (an empty treasury contributes nothing)
+	GC.getGame().updateRollingSyncChecksum(ROLLING_SYNC_CHECKSUM_GOLD, GetRollingSyncChecksum(), 0);
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
 	m_pPlayer = pPlayer;
 
 	m_iGold = 0;
@@ -139,6 +143,20 @@ int CvTreasury::GetGoldTimes100() const
 	return m_iGold;
 }
 
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+/// This player's contribution to the game's rolling sync checksum (an empty treasury contributes nothing)
+uint CvTreasury::GetRollingSyncChecksum() const
+{
+	if(m_iGold == 0 || m_pPlayer == NULL)
+		return 0;
+
+	uint uiHash = ROLLING_SYNC_CHECKSUM_SEED;
+	uiHash = RollingSyncChecksumMix(uiHash, m_pPlayer->GetID());
+	uiHash = RollingSyncChecksumMix(uiHash, m_iGold);
+	return uiHash;
+}
+
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
 /// Sets current balance in treasury (in hundredths)
 void CvTreasury::SetGoldTimes100(int iNewValue)
 {
@@ -150,7 +168,13 @@ void CvTreasury::SetGoldTimes100(int iNewValue)
 			CvAssertMsg(false, "GAMEPLAY: Player is being set to a negative Gold value. Please send Jon this with your last 5 autosaves.");
 		}
 
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+		uint uiOldSyncChecksum = GetRollingSyncChecksum();
+		m_iGold = iNewValue;
+		GC.getGame().updateRollingSyncChecksum(ROLLING_SYNC_CHECKSUM_GOLD, uiOldSyncChecksum, GetRollingSyncChecksum());
+#else
 		m_iGold = iNewValue;
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
 
 		if(m_pPlayer->GetID() == GC.getGame().getActivePlayer())
 		{
@@ -39,6 +39,9 @@ public:
 	int GetGoldTimes100() const;
 	void SetGoldTimes100(int iNewValue);
 	void ChangeGoldTimes100(int iChange);
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+	uint GetRollingSyncChecksum() const;
+#endif
 
 	// Gold from Cities
 	int GetGoldFromCities() const;
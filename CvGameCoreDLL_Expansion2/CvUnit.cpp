@@ -671,6 +671,9 @@ void CvUnit::initWithNameOffset(int iID, UnitTypes eUnit, int iNameOffset, UnitA
 	m_iArmyId = FFreeList::INVALID_INDEX;
 
 	m_eUnitAIType = eUnitAI;
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	UpdateOwnerUnitCounters();
+#endif // AUI_PLAYER_UNIT_COUNTERS
 
 	// Update Unit Production Maintenance
 	kPlayer.UpdateUnitProductionMaintenanceMod();
@@ -719,6 +722,13 @@ void CvUnit::uninit()
 void CvUnit::reset(int iID, UnitTypes eUnit, PlayerTypes eOwner, bool bConstructorCall)
 {
 	VALIDATE_OBJECT
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+	// Fields below are written directly, so take this unit's old contribution out of the rolling checksum first (a reset unit is off the map and contributes nothing)
+	if(!bConstructorCall)
+	{
+		GC.getGame().updateRollingSyncChecksum(ROLLING_SYNC_CHECKSUM_UNITS, GetRollingSyncChecksum(), 0);
+	}
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
 	int iI;
 
 	FAutoArchive& archive = getSyncArchive();
@@ -866,6 +876,13 @@ void CvUnit::reset(int iID, UnitTypes eUnit, PlayerTypes eOwner, bool bConstruct
 
 	m_bPromotionReady = false;
 	m_bDeathDelay = false;
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	m_bInOwnerUnitCounters = false;
+	m_eCountedUnitAIType = NO_UNITAI;
+	m_eCountedDomain = NO_DOMAIN;
+	m_eCountedUnitCombat = NO_UNITCOMBAT;
+	m_bCountedCombat = false;
+#endif // AUI_PLAYER_UNIT_COUNTERS
 	m_bCombatFocus = false;
 	m_bInfoBarDirty = false;
 	m_bNotConverting = false;
@@ -10334,6 +10351,12 @@ void CvUnit::SetBaseCombatStrength(int iCombat)
 {
 	VALIDATE_OBJECT
 	m_iBaseCombat = iCombat;
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	if(m_bInOwnerUnitCounters)
+	{
+		UpdateOwnerUnitCounters();
+	}
+#endif // AUI_PLAYER_UNIT_COUNTERS
 }
 
 //	--------------------------------------------------------------------------------
@@ -13460,6 +13483,9 @@ void CvUnit::setXY(int iX, int iY, bool bGroup, bool bUpdate, bool bShow, bool b
 		}
 	}
 
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+	uint uiOldSyncChecksum = GetRollingSyncChecksum();
+#endif
 	if(pNewPlot != NULL)
 	{
 		m_iX = pNewPlot->getX();
@@ -13470,6 +13496,16 @@ void CvUnit::setXY(int iX, int iY, bool bGroup, bool bUpdate, bool bShow, bool b
 		m_iX = INVALID_PLOT_COORD;
 		m_iY = INVALID_PLOT_COORD;
 	}
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+	GC.getGame().updateRollingSyncChecksum(ROLLING_SYNC_CHECKSUM_UNITS, uiOldSyncChecksum, GetRollingSyncChecksum());
+#endif
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	// hover units take the domain of the plot they are on
+	if(pNewPlot != NULL && m_bInOwnerUnitCounters && m_pUnitInfo->GetDomainType() == DOMAIN_HOVER)
+	{
+		UpdateOwnerUnitCounters();
+	}
+#endif // AUI_PLAYER_UNIT_COUNTERS
 
 	CvAssertMsg(plot() == pNewPlot, "plot is expected to equal pNewPlot");
 
@@ -14269,8 +14305,21 @@ int CvUnit::setDamage(int iNewValue, PlayerTypes ePlayer, float fAdditionalTextD
 		m_iLastGameTurnAtFullHealth = GC.getGame().getGameTurn();
 	}
 
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+	uint uiOldSyncChecksum = GetRollingSyncChecksum();
+	m_iDamage = range(iNewValue, 0, GetMaxHitPoints());
+	GC.getGame().updateRollingSyncChecksum(ROLLING_SYNC_CHECKSUM_UNITS, uiOldSyncChecksum, GetRollingSyncChecksum());
+#else
 	m_iDamage = range(iNewValue, 0, GetMaxHitPoints());
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
 	int iDiff = m_iDamage - iOldValue;
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	// dead units no longer count towards their UnitAI
+	if(iDiff != 0 && m_bInOwnerUnitCounters)
+	{
+		UpdateOwnerUnitCounters();
+	}
+#endif // AUI_PLAYER_UNIT_COUNTERS
 
 	CvAssertMsg(GetCurrHitPoints() >= 0, "currHitPoints() is expected to be non-negative (invalid Index)");
 
@@ -14561,11 +14610,17 @@ void CvUnit::setExperience(int iNewValue, int iMax)
 	{
 		int iExperienceChange = iNewValue - getExperience();
 
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+		uint uiOldSyncChecksum = GetRollingSyncChecksum();
+#endif
 #ifdef AUI_FAST_COMP
 		m_iExperience = FASTMIN(((iMax == -1) ? INT_MAX : iMax), iNewValue);
 #else
 		m_iExperience = std::min(((iMax == -1) ? INT_MAX : iMax), iNewValue);
 #endif // AUI_FAST_COMP
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+		GC.getGame().updateRollingSyncChecksum(ROLLING_SYNC_CHECKSUM_UNITS, uiOldSyncChecksum, GetRollingSyncChecksum());
+#endif
 		CvAssert(getExperience() >= 0);
 
 		if(getOwner() == GC.getGame().getActivePlayer())
@@ -14742,7 +14797,13 @@ void CvUnit::setLevel(int iNewValue)
 	VALIDATE_OBJECT
 	if(getLevel() != iNewValue)
 	{
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+		uint uiOldSyncChecksum = GetRollingSyncChecksum();
+		m_iLevel = iNewValue;
+		GC.getGame().updateRollingSyncChecksum(ROLLING_SYNC_CHECKSUM_UNITS, uiOldSyncChecksum, GetRollingSyncChecksum());
+#else
 		m_iLevel = iNewValue;
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
 		CvAssert(getLevel() >= 0);
 
 		if(getLevel() > GET_PLAYER(getOwner()).getHighestUnitLevel())
@@ -14765,6 +14826,27 @@ void CvUnit::changeLevel(int iChange)
 	setLevel(getLevel() + iChange);
 }
 
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+//	--------------------------------------------------------------------------------
+/// This unit's contribution to the game's rolling sync checksum (units that are not on the map contribute nothing)
+uint CvUnit::GetRollingSyncChecksum() const
+{
+	VALIDATE_OBJECT
+	if(m_iX == INVALID_PLOT_COORD)
+		return 0;
+
+	uint uiHash = ROLLING_SYNC_CHECKSUM_SEED;
+	uiHash = RollingSyncChecksumMix(uiHash, getOwner());
+	uiHash = RollingSyncChecksumMix(uiHash, GetID());
+	uiHash = RollingSyncChecksumMix(uiHash, m_iX);
+	uiHash = RollingSyncChecksumMix(uiHash, m_iY);
+	uiHash = RollingSyncChecksumMix(uiHash, m_iDamage);
+	uiHash = RollingSyncChecksumMix(uiHash, m_iExperience);
+	uiHash = RollingSyncChecksumMix(uiHash, m_iLevel);
+	return uiHash;
+}
+#endif // AUI_GAME_ROLLING_SYNC_CHECKSUM
+
 
 //	--------------------------------------------------------------------------------
 int CvUnit::getCargo() const
@@ -16784,6 +16866,12 @@ void CvUnit::startDelayedDeath()
 {
 	VALIDATE_OBJECT
 	m_bDeathDelay = true;
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	if(m_bInOwnerUnitCounters)
+	{
+		UpdateOwnerUnitCounters();
+	}
+#endif // AUI_PLAYER_UNIT_COUNTERS
 }
 
 
@@ -21219,9 +21307,48 @@ void CvUnit::AI_setUnitAIType(UnitAITypes eNewValue)
 	if(AI_getUnitAIType() != eNewValue)
 	{
 		m_eUnitAIType = eNewValue;
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+		if(m_bInOwnerUnitCounters)
+		{
+			UpdateOwnerUnitCounters();
+		}
+#endif // AUI_PLAYER_UNIT_COUNTERS
 	}
 }
 
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+//	--------------------------------------------------------------------------------
+/// Takes back what this unit last added to its owner's unit counters and, unless bRemoveOnly is set, adds its current UnitAI, domain and combat class instead
+void CvUnit::UpdateOwnerUnitCounters(bool bRemoveOnly, bool bOwnerCountersReset)
+{
+	VALIDATE_OBJECT
+	CvPlayer& kOwner = GET_PLAYER(getOwner());
+
+	if(m_bInOwnerUnitCounters && !bOwnerCountersReset)
+	{
+		kOwner.ChangeUnitCounters(m_eCountedUnitAIType, m_eCountedDomain == DOMAIN_SEA, m_eCountedDomain, m_bCountedCombat, m_eCountedUnitCombat, -1);
+	}
+	m_bInOwnerUnitCounters = false;
+
+	if(bRemoveOnly || m_pUnitInfo == NULL)
+	{
+		return;
+	}
+
+#ifdef AUI_PLAYER_FIX_GET_NUM_UNITS_WITH_UNITAI_NO_DEAD
+	m_eCountedUnitAIType = (IsDead() || isDelayedDeath()) ? NO_UNITAI : AI_getUnitAIType();
+#else
+	m_eCountedUnitAIType = AI_getUnitAIType();
+#endif // AUI_PLAYER_FIX_GET_NUM_UNITS_WITH_UNITAI_NO_DEAD
+	m_eCountedDomain = getDomainType();
+	m_eCountedUnitCombat = getUnitCombatType();
+	m_bCountedCombat = IsCombatUnit();
+
+	kOwner.ChangeUnitCounters(m_eCountedUnitAIType, m_eCountedDomain == DOMAIN_SEA, m_eCountedDomain, m_bCountedCombat, m_eCountedUnitCombat, 1);
+	m_bInOwnerUnitCounters = true;
+}
+#endif // AUI_PLAYER_UNIT_COUNTERS
+
 //	--------------------------------------------------------------------------------
 void CvUnit::AI_promote()
 {
@@ -698,6 +698,9 @@ public:
 	int getLevel() const;
 	void setLevel(int iNewValue);
 	void changeLevel(int iChange);
+#ifdef AUI_GAME_ROLLING_SYNC_CHECKSUM
+	uint GetRollingSyncChecksum() const;
+#endif
 
 	int getCargo() const;
 	void changeCargo(int iChange);
@@ -1131,6 +1134,9 @@ public:
 	UnitAITypes AI_getUnitAIType() const;
 	void AI_setUnitAIType(UnitAITypes eNewValue);
 	int AI_promotionValue(PromotionTypes ePromotion);
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	void UpdateOwnerUnitCounters(bool bRemoveOnly = false, bool bOwnerCountersReset = false);
+#endif // AUI_PLAYER_UNIT_COUNTERS
 
 	GreatPeopleDirectiveTypes GetGreatPeopleDirective() const;
 	void SetGreatPeopleDirective(GreatPeopleDirectiveTypes eDirective);
@@ -1421,6 +1427,14 @@ protected:
 
 	FAutoVariable<bool, CvUnit> m_bPromotionReady;
 	FAutoVariable<bool, CvUnit> m_bDeathDelay;
+#ifdef AUI_PLAYER_UNIT_COUNTERS
+	// what this unit currently adds to its owner's unit counters (not saved, owner rebuilds counters on load)
+	bool m_bInOwnerUnitCounters;
+	UnitAITypes m_eCountedUnitAIType;
+	DomainTypes m_eCountedDomain;
+	UnitCombatTypes m_eCountedUnitCombat;
+	bool m_bCountedCombat;
+#endif // AUI_PLAYER_UNIT_COUNTERS
 	FAutoVariable<bool, CvUnit> m_bCombatFocus;
 	FAutoVariable<bool, CvUnit> m_bInfoBarDirty;
 	FAutoVariable<bool, CvUnit> m_bNotConverting;
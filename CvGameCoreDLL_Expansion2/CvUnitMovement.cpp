@@ -260,18 +260,51 @@ bool CvUnitMovement::IsSlowedByZOC(const CvUnit* pUnit, const CvPlot* pFromPlot,
 
 		int iFromPlotX = pFromPlot->getX();
 		int iFromPlotY = pFromPlot->getY();
+#ifndef AUI_UNIT_MOVEMENT_ZOC_SHARED_NEIGHBORS_ONLY
 		int iToPlotX = pToPlot->getX();
 		int iToPlotY = pToPlot->getY();
+#endif // AUI_UNIT_MOVEMENT_ZOC_SHARED_NEIGHBORS_ONLY
 		TeamTypes unit_team_type     = pUnit->getTeam();
 		DomainTypes unit_domain_type = pUnit->getDomainType();
 		bool bIsVisibleEnemyUnit     = pToPlot->isVisibleEnemyUnit(pUnit);
 		CvTeam& kUnitTeam = GET_TEAM(unit_team_type);
+#ifdef AUI_UNIT_MOVEMENT_ZOC_SHARED_NEIGHBORS_ONLY
+		// Only plots adjacent to both origin and destination can exert zone of control on this move; for a one-plot step these are the neighbors on either side of the step's direction
+		DirectionTypes eMoveDirection = directionXY(pFromPlot, pToPlot);
+		bool bSingleStep = (eMoveDirection != NO_DIRECTION && plotDirection(iFromPlotX, iFromPlotY, eMoveDirection) == pToPlot);
+		int iSharedDirection1 = (eMoveDirection + 1) % NUM_DIRECTION_TYPES;
+		int iSharedDirection2 = (eMoveDirection + NUM_DIRECTION_TYPES - 1) % NUM_DIRECTION_TYPES;
+#endif // AUI_UNIT_MOVEMENT_ZOC_SHARED_NEIGHBORS_ONLY
 
 		for(int iDirection0 = 0; iDirection0 < NUM_DIRECTION_TYPES; iDirection0++)
 		{
+#ifdef AUI_UNIT_MOVEMENT_ZOC_SHARED_NEIGHBORS_ONLY
+			if(bSingleStep && iDirection0 != iSharedDirection1 && iDirection0 != iSharedDirection2)
+			{
+				continue;
+			}
+#endif // AUI_UNIT_MOVEMENT_ZOC_SHARED_NEIGHBORS_ONLY
 			CvPlot* pAdjPlot = plotDirection(iFromPlotX, iFromPlotY, ((DirectionTypes)iDirection0));
 			if(NULL != pAdjPlot)
 			{
+#ifdef AUI_UNIT_MOVEMENT_ZOC_SHARED_NEIGHBORS_ONLY
+				if(!bSingleStep && !pAdjPlot->isAdjacent(pToPlot))
+				{
+					continue;
+				}
+
+				// check city zone of control (destination is known to be adjacent)
+				if(pAdjPlot->isEnemyCity(*pUnit))
+				{
+					return true;
+				}
+
+				// Enemy units can't exert zone of control onto a plot holding a visible enemy unit
+				if(bIsVisibleEnemyUnit)
+				{
+					continue;
+				}
+#else
 				// check city zone of control
 				if(pAdjPlot->isEnemyCity(*pUnit))
 				{
@@ -289,6 +322,7 @@ bool CvUnitMovement::IsSlowedByZOC(const CvUnit* pUnit, const CvPlot* pFromPlot,
 						}
 					}
 				}
+#endif // AUI_UNIT_MOVEMENT_ZOC_SHARED_NEIGHBORS_ONLY
 
 				pAdjUnitNode = pAdjPlot->headUnitNode();
 				// Loop through all units to see if there's an enemy unit here
@@ -343,6 +377,10 @@ bool CvUnitMovement::IsSlowedByZOC(const CvUnit* pUnit, const CvPlot* pFromPlot,
 							continue;
 						}
 
+#ifdef AUI_UNIT_MOVEMENT_ZOC_SHARED_NEIGHBORS_ONLY
+						// Destination is known to be adjacent to this enemy unit and not to hold a visible enemy unit
+						return true;
+#else
 						// Loop through plots adjacent to the enemy unit and see if it's the same as our unit's Destination Plot
 						for(int iDirection2 = 0; iDirection2 < NUM_DIRECTION_TYPES; iDirection2++)
 						{
@@ -362,6 +400,7 @@ bool CvUnitMovement::IsSlowedByZOC(const CvUnit* pUnit, const CvPlot* pFromPlot,
 								}
 							}
 						}
+#endif // AUI_UNIT_MOVEMENT_ZOC_SHARED_NEIGHBORS_ONLY
 					}
 				}
 			}
@@ -7394,6 +7394,9 @@ FDataStream& operator<<(FDataStream& saveTo, const CvGameLeagues& readFrom)
 CvLeagueAI::CvLeagueAI(void)
 {
 	m_pPlayer = NULL;
+#ifdef AUI_VOTING_SCORE_CACHE
+	m_iScoreCacheDepth = 0;
+#endif // AUI_VOTING_SCORE_CACHE
 }
 
 CvLeagueAI::~CvLeagueAI(void)
@@ -7418,6 +7421,9 @@ void CvLeagueAI::Uninit()
 void CvLeagueAI::Reset()
 {
 	m_vVoteCommitmentList.clear();
+#ifdef AUI_VOTING_SCORE_CACHE
+	ResetScoreCaches();
+#endif // AUI_VOTING_SCORE_CACHE
 }
 
 void CvLeagueAI::Read(FDataStream& kStream)
@@ -7425,6 +7431,10 @@ void CvLeagueAI::Read(FDataStream& kStream)
 	uint uiVersion;
 	kStream >> uiVersion;
 
+#ifdef AUI_VOTING_SCORE_CACHE
+	ResetScoreCaches();
+#endif // AUI_VOTING_SCORE_CACHE
+
 	if (uiVersion >= 2)
 	{
 		m_vVoteCommitmentList.clear();
@@ -7847,6 +7857,38 @@ void CvLeagueAI::DoVoteCommitments(CvLeague* pLeague)
 // How much do we like this vote commitment (either from us to someone else, or from someone else to us)?
 CvLeagueAI::DesireLevels CvLeagueAI::EvaluateVoteForTrade(int iResolutionID, int iVoteChoice, int iNumVotes, bool bRepeal)
 {
+#ifdef AUI_VOTING_SCORE_CACHE
+	if (m_iScoreCacheDepth <= 0)
+	{
+		return EvaluateVoteForTradeInternal(iResolutionID, iVoteChoice, iNumVotes, bRepeal);
+	}
+
+	// Our votes are always worth our core votes, so the resolution, choice and repeal flag are all that matter
+	VoteTradeDesireKey kKey;
+	kKey.m_iResolutionID = iResolutionID;
+	kKey.m_iVoteChoice = iVoteChoice;
+	kKey.m_bRepeal = bRepeal;
+	VoteTradeDesireCache::const_iterator itCached = m_VoteTradeDesireCache.find(kKey);
+	bool bCached = (itCached != m_VoteTradeDesireCache.end());
+#ifndef AUI_VOTING_SCORE_CACHE_VALIDATE
+	if (bCached)
+	{
+		return (*itCached).second;
+	}
+#endif
+
+	DesireLevels eDesire = EvaluateVoteForTradeInternal(iResolutionID, iVoteChoice, iNumVotes, bRepeal);
+#ifdef AUI_VOTING_SCORE_CACHE_VALIDATE
+	CvAssertMsg(!bCached || (*itCached).second == eDesire, "Remembered vote trade desire differs from the recalculated one.");
+#endif
+	m_VoteTradeDesireCache[kKey] = eDesire;
+	return eDesire;
+}
+
+/// Does the actual work of EvaluateVoteForTrade() when the desire is not remembered yet
+CvLeagueAI::DesireLevels CvLeagueAI::EvaluateVoteForTradeInternal(int iResolutionID, int iVoteChoice, int iNumVotes, bool bRepeal)
+{
+#endif // AUI_VOTING_SCORE_CACHE
 	DEBUG_VARIABLE(iNumVotes);
 	DesireLevels eValue = DESIRE_NEVER;
 	
@@ -7934,6 +7976,32 @@ CvLeagueAI::DesireLevels CvLeagueAI::EvaluateProposalForProposer(CvLeague* pLeag
 // Calculate how much we think our interests are aligned with ePlayer, based on ideology, liberation, past voting patterns, etc.
 CvLeagueAI::AlignmentLevels CvLeagueAI::EvaluateAlignment(PlayerTypes ePlayer)
 {
+#ifdef AUI_VOTING_SCORE_CACHE
+	if (m_iScoreCacheDepth <= 0 || ePlayer < 0 || ePlayer >= MAX_PLAYERS)
+	{
+		return EvaluateAlignmentInternal(ePlayer);
+	}
+
+	AlignmentLevels eCached = m_aeAlignmentCache[ePlayer];
+#ifndef AUI_VOTING_SCORE_CACHE_VALIDATE
+	if (eCached != NUM_ALIGNMENT_LEVELS)
+	{
+		return eCached;
+	}
+#endif
+
+	AlignmentLevels eAlignment = EvaluateAlignmentInternal(ePlayer);
+#ifdef AUI_VOTING_SCORE_CACHE_VALIDATE
+	CvAssertMsg(eCached == NUM_ALIGNMENT_LEVELS || eCached == eAlignment, "Remembered alignment differs from the recalculated one.");
+#endif
+	m_aeAlignmentCache[ePlayer] = eAlignment;
+	return eAlignment;
+}
+
+/// Does the actual work of EvaluateAlignment() when the alignment is not remembered yet
+CvLeagueAI::AlignmentLevels CvLeagueAI::EvaluateAlignmentInternal(PlayerTypes ePlayer)
+{
+#endif // AUI_VOTING_SCORE_CACHE
 	if (ePlayer == NO_PLAYER)
 	{
 		return ALIGNMENT_NEUTRAL;
@@ -8510,6 +8578,16 @@ CvLeagueAI::DesireLevels CvLeagueAI::EvaluateDesire(int iRawScore)
 // Find the most preferred use of our votes in the session of pLeague, and allocate them with some randomness
 void CvLeagueAI::AllocateVotes(CvLeague* pLeague)
 {
+#ifdef AUI_VOTING_SCORE_CACHE
+	BeginScoreCaching();
+	AllocateVotesInternal(pLeague);
+	EndScoreCaching();
+}
+
+// Does the actual work of AllocateVotes() while vote choice and alignment scores are being remembered
+void CvLeagueAI::AllocateVotesInternal(CvLeague* pLeague)
+{
+#endif // AUI_VOTING_SCORE_CACHE
 	CvAssert(pLeague != NULL);
 	if (!(pLeague != NULL)) 
 		return;
@@ -11209,6 +11287,16 @@ int CvLeagueAI::ScoreVoteChoicePlayer(CvProposal* pProposal, int iChoice, bool b
 
 void CvLeagueAI::AllocateProposals(CvLeague* pLeague)
 {
+#ifdef AUI_VOTING_SCORE_CACHE
+	BeginScoreCaching();
+	AllocateProposalsInternal(pLeague);
+	EndScoreCaching();
+}
+
+// Does the actual work of AllocateProposals() while vote choice and alignment scores are being remembered
+void CvLeagueAI::AllocateProposalsInternal(CvLeague* pLeague)
+{
+#endif // AUI_VOTING_SCORE_CACHE
 	ProposalConsiderationList vConsiderations;
 
 	std::vector<ResolutionTypes> vInactive = pLeague->GetInactiveResolutions();
@@ -11351,6 +11439,45 @@ int CvLeagueAI::ScoreProposal(CvLeague* pLeague, CvActiveResolution* pResolution
 	return iYesScore;
 }
 
+#ifdef AUI_VOTING_SCORE_CACHE
+// Forget all remembered scores
+void CvLeagueAI::ResetScoreCaches()
+{
+	m_VoteTradeDesireCache.clear();
+	for (int i = 0; i < MAX_PLAYERS; i++)
+	{
+		m_aeAlignmentCache[i] = NUM_ALIGNMENT_LEVELS;
+	}
+	m_iScoreCacheDepth = 0;
+}
+
+// Game state cannot change while we allocate votes or proposals or while a deal is being equalized, so alignments and vote trade desires are remembered until the matching EndScoreCaching() call
+void CvLeagueAI::BeginScoreCaching()
+{
+	m_iScoreCacheDepth++;
+}
+
+// Forgets remembered scores once the outermost caller is done
+void CvLeagueAI::EndScoreCaching()
+{
+	CvAssertMsg(m_iScoreCacheDepth > 0, "Vote score caching ended more often than it was started.");
+	m_iScoreCacheDepth--;
+	if (m_iScoreCacheDepth <= 0)
+	{
+		ResetScoreCaches();
+	}
+}
+
+bool CvLeagueAI::VoteTradeDesireKey::operator<(const VoteTradeDesireKey& rhs) const
+{
+	if (m_iResolutionID != rhs.m_iResolutionID)
+		return m_iResolutionID < rhs.m_iResolutionID;
+	if (m_iVoteChoice != rhs.m_iVoteChoice)
+		return m_iVoteChoice < rhs.m_iVoteChoice;
+	return !m_bRepeal && rhs.m_bRepeal;
+}
+#endif // AUI_VOTING_SCORE_CACHE
+
 void CvLeagueAI::LogVoteChoiceConsidered(CvEnactProposal* pProposal, int iChoice, int iScore)
 {
 	CvAssert(pProposal != NULL);
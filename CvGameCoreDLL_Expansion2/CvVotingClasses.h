@@ -861,6 +861,10 @@ public:
 	DesireLevels EvaluateProposalForProposer(CvLeague* pLeague, PlayerTypes eProposer, ResolutionTypes eResolution, int iProposerChoice = LeagueHelpers::CHOICE_NONE);
 	DesireLevels EvaluateProposalForProposer(CvLeague* pLeague, PlayerTypes eProposer, int iTargetResolutionID);
 	AlignmentLevels EvaluateAlignment(PlayerTypes ePlayer);
+#ifdef AUI_VOTING_SCORE_CACHE
+	void BeginScoreCaching();
+	void EndScoreCaching();
+#endif // AUI_VOTING_SCORE_CACHE
 
 	// Masked knowledge for other players
 	KnowledgeLevels GetKnowledgeGivenToOtherPlayer(PlayerTypes eToPlayer, CvString* sTooltipSink = NULL);
@@ -894,17 +898,44 @@ private:
 	int ScoreVoteChoice(CvRepealProposal* pProposal, int iChoice);
 	int ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bEnact);
 	int ScoreVoteChoicePlayer(CvProposal* pProposal, int iChoice, bool bEnact);
+#ifdef AUI_VOTING_SCORE_CACHE
+	void AllocateVotesInternal(CvLeague* pLeague);
+	DesireLevels EvaluateVoteForTradeInternal(int iResolutionID, int iVoteChoice, int iNumVotes, bool bRepeal);
+	AlignmentLevels EvaluateAlignmentInternal(PlayerTypes ePlayer);
+#endif // AUI_VOTING_SCORE_CACHE
 
 	// Proposing
 	void AllocateProposals(CvLeague* pLeague);
 	int ScoreProposal(CvLeague* pLeague, ResolutionTypes eResolution, int iChoice = LeagueHelpers::CHOICE_NONE);
 	int ScoreProposal(CvLeague* pLeague, CvActiveResolution* pResolution);
+#ifdef AUI_VOTING_SCORE_CACHE
+	void AllocateProposalsInternal(CvLeague* pLeague);
+#endif // AUI_VOTING_SCORE_CACHE
 
 	// Logging
 	void LogVoteChoiceConsidered(CvEnactProposal* pProposal, int iChoice, int iScore);
 	void LogVoteChoiceConsidered(CvRepealProposal* pProposal, int iChoice, int iScore);
 	void LogVoteChoiceCommitted(CvEnactProposal* pProposal, int iChoice, int iVotes);
 	void LogVoteChoiceCommitted(CvRepealProposal* pProposal, int iChoice, int iVotes);
+
+#ifdef AUI_VOTING_SCORE_CACHE
+	void ResetScoreCaches();
+
+	/// Everything EvaluateVoteForTrade() depends on besides game state
+	struct VoteTradeDesireKey
+	{
+		int m_iResolutionID;
+		int m_iVoteChoice;
+		bool m_bRepeal;
+
+		bool operator<(const VoteTradeDesireKey& rhs) const;
+	};
+	typedef std::map<VoteTradeDesireKey, DesireLevels> VoteTradeDesireCache;
+
+	VoteTradeDesireCache m_VoteTradeDesireCache;	// NOT SERIALIZED
+	AlignmentLevels m_aeAlignmentCache[MAX_PLAYERS];	// NOT SERIALIZED, NUM_ALIGNMENT_LEVELS if not evaluated yet
+	int m_iScoreCacheDepth;							// NOT SERIALIZED, scores are only remembered while this is above 0
+#endif // AUI_VOTING_SCORE_CACHE
 };
 
 
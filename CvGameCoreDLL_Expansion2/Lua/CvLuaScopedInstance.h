@@ -27,8 +27,18 @@ public:
 
 protected:
 	static void DefaultHandleMissingInstance(lua_State* L);
+
+#ifdef AUI_LUA_SCOPED_INSTANCE_LIGHTUSERDATA_KEY
+	//! Only its address is used, as the light userdata key holding the instance pointer.
+	static char s_cInstanceKey;
+#endif // AUI_LUA_SCOPED_INSTANCE_LIGHTUSERDATA_KEY
 };
 
+#ifdef AUI_LUA_SCOPED_INSTANCE_LIGHTUSERDATA_KEY
+template<class Derived, class InstanceType>
+char CvLuaScopedInstance<Derived, InstanceType>::s_cInstanceKey = 0;
+#endif // AUI_LUA_SCOPED_INSTANCE_LIGHTUSERDATA_KEY
+
 
 
 //------------------------------------------------------------------------------
@@ -93,7 +103,14 @@ void CvLuaScopedInstance<Derived, InstanceType>::Push(lua_State* L, InstanceType
 			lua_pop(L, 1);
 
 			//Push new instance
+#ifdef AUI_LUA_SCOPED_INSTANCE_LIGHTUSERDATA_KEY
+			lua_createtable(L, 0, 2);
+			lua_pushlightuserdata(L, &s_cInstanceKey);
+			lua_pushlightuserdata(L, pkType);
+			lua_rawset(L, -3);					// t[key] = pkType
+#else
 			lua_createtable(L, 0, 1);
+#endif // AUI_LUA_SCOPED_INSTANCE_LIGHTUSERDATA_KEY
 			lua_pushlightuserdata(L, pkType);
 			lua_setfield(L, -2, "__instance");
 
@@ -131,7 +148,20 @@ InstanceType* CvLuaScopedInstance<Derived, InstanceType>::GetInstance(lua_State*
 	InstanceType* pkInstance = NULL;
 	if(lua_type(L, idx) == LUA_TTABLE)
 	{
+#ifdef AUI_LUA_SCOPED_INSTANCE_LIGHTUSERDATA_KEY
+		//Pushing the key shifts relative indices
+		const int table_index = (idx < 0 && idx > LUA_REGISTRYINDEX) ? stack_size + idx + 1 : idx;
+		lua_pushlightuserdata(L, &s_cInstanceKey);
+		lua_rawget(L, table_index);
+		if(lua_type(L, -1) != LUA_TLIGHTUSERDATA)
+		{
+			//Tables that only carry "__instance" (e.g. through an __index metatable) still work
+			lua_pop(L, 1);
+			lua_getfield(L, table_index, "__instance");
+		}
+#else
 		lua_getfield(L, idx, "__instance");
+#endif // AUI_LUA_SCOPED_INSTANCE_LIGHTUSERDATA_KEY
 		if(lua_type(L, -1) == LUA_TLIGHTUSERDATA)
 		{
 			pkInstance = static_cast<InstanceType*>(lua_touserdata(L, -1));
@@ -218,9 +218,63 @@ protected:
 FDataStream & operator<<(FDataStream & saveTo, FDataStream & readFrom);
 FDataStream & operator>>(FDataStream & loadFrom, FDataStream & writeTo);
 
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+//-----------------------------------------------------------------------
+// Arithmetic types are written to the stream as their raw bytes, so when the stream
+// does not need to swap endianness, a whole array of them can be moved with a single
+// ReadIt/WriteIt instead of one virtual call per element. The resulting bytes are
+// identical to the per-element path, so old and new saves stay interchangeable.
+//-----------------------------------------------------------------------
+template<typename T> struct FDataStreamBulkType { enum { value = false }; };
+template<> struct FDataStreamBulkType<int> { enum { value = true }; };
+template<> struct FDataStreamBulkType<unsigned int> { enum { value = true }; };
+template<> struct FDataStreamBulkType<long> { enum { value = true }; };
+template<> struct FDataStreamBulkType<unsigned long> { enum { value = true }; };
+template<> struct FDataStreamBulkType<short> { enum { value = true }; };
+template<> struct FDataStreamBulkType<unsigned short> { enum { value = true }; };
+template<> struct FDataStreamBulkType<char> { enum { value = true }; };
+template<> struct FDataStreamBulkType<unsigned char> { enum { value = true }; };
+template<> struct FDataStreamBulkType<INT64> { enum { value = true }; };
+template<> struct FDataStreamBulkType<UINT64> { enum { value = true }; };
+template<> struct FDataStreamBulkType<float> { enum { value = true }; };
+template<> struct FDataStreamBulkType<double> { enum { value = true }; };
+
+inline bool FDataStreamCanBulkCopy(const FDataStream & kStream)
+{
+	FEndian::EEndianness eDesired = kStream.GetDesiredEndianNess();
+	return (eDesired == FEndian::ENDIAN_UNKNOWN || eDesired == FEndian::GetEndianness());
+}
+
+// Returns true if the values were written as a single block, false if the caller must write them one by one
+template<typename T>
+inline bool FDataStreamBulkWrite(FDataStream & saveTo, unsigned int count, const T * values)
+{
+	if(!FDataStreamBulkType<T>::value || !FDataStreamCanBulkCopy(saveTo))
+		return false;
+	if(count > 0)
+		saveTo.WriteIt(count * sizeof(T), values);
+	return true;
+}
+
+// Returns true if the values were read as a single block, false if the caller must read them one by one
+template<typename T>
+inline bool FDataStreamBulkRead(FDataStream & loadFrom, unsigned int count, T * values)
+{
+	if(!FDataStreamBulkType<T>::value || !FDataStreamCanBulkCopy(loadFrom))
+		return false;
+	if(count > 0)
+		loadFrom.ReadIt(count * sizeof(T), values);
+	return true;
+}
+#endif // AUI_DATASTREAM_BULK_POD_SERIALIZATION
+
 template<typename ValueType, size_t count>
 FDataStream & operator<<(FDataStream & saveTo, const ValueType (&readFrom)[count])
 {
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+	if(FDataStreamBulkWrite(saveTo, count, &readFrom[0]))
+		return saveTo;
+#endif
 	size_t i = 0;
 	for(i = 0; i < count; ++i)
 	{
@@ -232,6 +286,10 @@ FDataStream & operator<<(FDataStream & saveTo, const ValueType (&readFrom)[count
 template<typename ValueType, size_t count>
 FDataStream & operator>>(FDataStream & loadFrom, ValueType (&writeTo)[count])
 {
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+	if(FDataStreamBulkRead(loadFrom, count, &writeTo[0]))
+		return loadFrom;
+#endif
 	size_t i = 0;
 	for(i = 0; i < count; ++i)
 	{
@@ -403,6 +461,11 @@ public:
 		int iArrayCount = getCount();
 		int readCount = (iStreamCount < iArrayCount)?iStreamCount:iArrayCount;
 		ValueType * values = getArray();
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+		if(readCount > 0 && FDataStreamBulkRead(readFrom, readCount, values))
+			i = readCount;
+		else
+#endif
 		for(i = 0; i < readCount; ++i)
 		{
 			readFrom >> values[i];
@@ -432,6 +495,10 @@ public:
 		int count = getCount();
 		writeTo << count;
 		const ValueType * values = getArray();
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+		if(FDataStreamBulkWrite(writeTo, count, values))
+			return;
+#endif
 		for(i = 0; i < count; ++i)
 		{
 			writeTo << values[i];
@@ -473,6 +540,10 @@ public:
 		int count = getCount();
 		writeTo << count;
 		const ValueType * values = getArray();
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+		if(FDataStreamBulkWrite(writeTo, count, values))
+			return;
+#endif
 		for(i = 0; i < count; ++i)
 		{
 			writeTo << values[i];
@@ -503,6 +574,10 @@ FDataStream & operator<<(FDataStream & saveTo, const ArrayWrapper<ValueType> & v
 	int i = 0;
 	int count = v.getCount();
 	const ValueType * values = v.getArray();
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+	if(count > 0 && FDataStreamBulkWrite(saveTo, count, values))
+		return saveTo;
+#endif
 	for(i = 0; i < count; ++i)
 	{
 		saveTo << values[i];
@@ -516,6 +591,10 @@ FDataStream & operator>>(FDataStream & loadFrom, ArrayWrapper<ValueType> & v)
 	int i = 0;
 	int count = v.getCount();
 	ValueType * values = v.getArray();
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+	if(count > 0 && FDataStreamBulkRead(loadFrom, count, values))
+		return loadFrom;
+#endif
 	for(i = 0; i < count; ++i)
 	{
 		loadFrom >> values[i];
@@ -529,6 +608,10 @@ FDataStream & operator<<(FDataStream & saveTo, const ArrayWrapperConst<ValueType
 	int i = 0;
 	int count = v.getCount();
 	const ValueType * values = v.getArray();
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+	if(count > 0 && FDataStreamBulkWrite(saveTo, count, values))
+		return saveTo;
+#endif
 	for(i = 0; i < count; ++i)
 	{
 		saveTo << values[i];
@@ -542,6 +625,10 @@ FDataStream & operator>>(FDataStream & loadFrom, ArrayWrapperConst<ValueType> &
 	int i = 0;
 	int count = v.getCount();
 	ValueType * values = v.getArray();
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+	if(count > 0 && FDataStreamBulkRead(loadFrom, count, values))
+		return loadFrom;
+#endif
 	for(i = 0; i < count; ++i)
 	{
 		loadFrom >> values[i];
@@ -593,6 +680,10 @@ FDataStream & operator >> ( FDataStream & kStream, FFastVector< T, bPODType, All
 		kVec.push_back_copy(T(), count);
 	}
 	
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+	if(iSize > 0 && FDataStreamBulkRead(kStream, iSize, &kVec[0]))
+		return kStream;
+#endif
 	unsigned int i = 0;
 	for( i = 0; i < iSize; ++i )
 	{
@@ -605,6 +696,10 @@ template< class T, bool bPODType, unsigned int AllocPool, unsigned int nSubID >
 FDataStream & operator << ( FDataStream & kStream, const FFastVector< T, bPODType, AllocPool, nSubID > & kVec )
 {
 	kStream << kVec.size();
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+	if(kVec.size() > 0 && FDataStreamBulkWrite(kStream, kVec.size(), &kVec[0]))
+		return kStream;
+#endif
 	for( unsigned int i = 0; i < kVec.size(); ++i )
 	{
 		kStream << kVec[i];
@@ -619,6 +714,10 @@ FDataStream & operator >> ( FDataStream & kStream, FStaticVector< T, L, bPODType
 	kStream >> iSize;
 	kVec.resize( iSize );
 
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+	if(iSize > 0 && FDataStreamBulkRead(kStream, iSize, &kVec[0]))
+		return kStream;
+#endif
 	for( unsigned int i = 0; i < iSize; ++i )
 	{
 		kStream >> kVec[i];
@@ -631,6 +730,10 @@ FDataStream & operator << ( FDataStream & kStream, const FStaticVector< T, L, bP
 {
 	kStream << (unsigned int)kVec.size();
 
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+	if(kVec.size() > 0 && FDataStreamBulkWrite(kStream, kVec.size(), &kVec[0]))
+		return kStream;
+#endif
 	for( unsigned int i = 0; i < kVec.size(); ++i )
 	{
 		kStream << kVec[i];
@@ -151,6 +151,44 @@ void SerializeToAssociativeContainer(FDataStream & loadFrom, ContainerType & con
 	}
 }
 
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+// Vectors of arithmetic types are stored contiguously, so they can be moved as one block.
+// The element count is written exactly like SerializeFromSequenceContainer does it.
+// Non-arithmetic types (including the std::vector<bool> bitfield) fall back to the per-element path.
+template<typename ElementType, bool bBulk = FDataStreamBulkType<ElementType>::value>
+struct SerializeBulkVector
+{
+	static bool Write(FDataStream &, const std::vector<ElementType> &) { return false; }
+	static bool Read(FDataStream &, std::vector<ElementType> &) { return false; }
+};
+
+template<typename ElementType>
+struct SerializeBulkVector<ElementType, true>
+{
+	static bool Write(FDataStream & saveTo, const std::vector<ElementType> & readFrom)
+	{
+		if(!FDataStreamCanBulkCopy(saveTo))
+			return false;
+		saveTo << readFrom.size();
+		if(!readFrom.empty())
+			FDataStreamBulkWrite(saveTo, readFrom.size(), &readFrom[0]);
+		return true;
+	}
+	static bool Read(FDataStream & loadFrom, std::vector<ElementType> & writeTo)
+	{
+		if(!FDataStreamCanBulkCopy(loadFrom))
+			return false;
+		std::vector<ElementType>::size_type count = 0;
+		loadFrom >> count;
+		writeTo.clear();
+		writeTo.resize(count);
+		if(count > 0)
+			FDataStreamBulkRead(loadFrom, count, &writeTo[0]);
+		return true;
+	}
+};
+#endif // AUI_DATASTREAM_BULK_POD_SERIALIZATION
+
 template<typename KeyType, typename ElementType>
 FDataStream & operator<<(FDataStream & saveTo, const std::map<KeyType, ElementType> & readFrom)
 {
@@ -196,6 +234,10 @@ FDataStream & operator<<(FDataStream & saveTo, const std::list<ElementType> & re
 template<typename ElementType> 
 FDataStream & operator<<(FDataStream & saveTo, const std::vector<ElementType> & readFrom)
 {
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+	if(SerializeBulkVector<ElementType>::Write(saveTo, readFrom))
+		return saveTo;
+#endif
 	std::for_each(readFrom.begin(), readFrom.end(), SerializeFromSequenceContainer<const ElementType, const std::vector<ElementType> >(saveTo, readFrom));
 	return saveTo;
 }
@@ -223,6 +265,10 @@ FDataStream & operator>>(FDataStream & loadFrom, std::list<ElementType> & writeT
 template<typename ElementType>
 FDataStream & operator>>(FDataStream & loadFrom, std::vector<ElementType> & writeTo)
 {
+#ifdef AUI_DATASTREAM_BULK_POD_SERIALIZATION
+	if(SerializeBulkVector<ElementType>::Read(loadFrom, writeTo))
+		return loadFrom;
+#endif
 	// The functor needs to be instantiated to properly resize the container based 
 	// on how many elements the stream says it should have before passing it along
 	// to std::for_each